@@ -34,6 +34,19 @@ void TAlgGenetico::setRoleta (int val)             { VP_roleta             = val
 void TAlgGenetico::setSelIndMutacao (int val)      { VP_selIndMutacao      = val; }
 void TAlgGenetico::setPercentReducao (int val)     { VP_percentReducao = val; }
 void TAlgGenetico::setAtivaRecursivo (int val)     { VP_ativaRecursivo = val; }
+void TAlgGenetico::setNumCandidatos (int val)      { VP_numCandidatos = val; }
+void TAlgGenetico::setProfundidadeLK (int val)     { VP_profundidadeLK = val; }
+void TAlgGenetico::setNumThreads (int val)         { VP_numThreads = val; }
+void TAlgGenetico::setMaxAvaliacoes (int val)      { VP_maxAvaliacoes = val; }
+void TAlgGenetico::setMaxTempoMutacao (int val)    { VP_maxTempoMutacao = val; }
+void TAlgGenetico::setTemperaturaSA (int val)      { VP_temperaturaSA = val; }
+void TAlgGenetico::setResfriamentoSA (int val)     { VP_resfriamentoSA = val; }
+void TAlgGenetico::setIteracoesSA (int val)        { VP_iteracoesSA = val; }
+void TAlgGenetico::setFilhosEAX (int val)          { VP_filhosEAX = val; }
+void TAlgGenetico::setEstrategiaEAX (int val)      { VP_estrategiaEAX = val; }
+void TAlgGenetico::setPodaFilhos (int val)         { VP_podaFilhos = val; }
+void TAlgGenetico::setTamTorneio (int val)         { VP_tamTorneio = val; }
+void TAlgGenetico::setModoAG (int val)             { VP_modoAG = val; }
 
 int TAlgGenetico::getPercentReducao ()     { return VP_percentReducao; }
 int TAlgGenetico::getAtivaRecursivo ()     { return VP_ativaRecursivo; }
@@ -48,6 +61,19 @@ int TAlgGenetico::getCruzamento ()         { return VP_cruzamento; }
 int TAlgGenetico::getPercentElitismo ()    { return VP_percentElitismo; }
 int TAlgGenetico::getRoleta ()             { return VP_roleta; }
 int TAlgGenetico::getSelIndMutacao ()      { return VP_selIndMutacao; }
+int TAlgGenetico::getNumCandidatos ()      { return VP_numCandidatos; }
+int TAlgGenetico::getProfundidadeLK ()     { return VP_profundidadeLK; }
+int TAlgGenetico::getNumThreads ()         { return VP_numThreads; }
+int TAlgGenetico::getMaxAvaliacoes ()      { return VP_maxAvaliacoes; }
+int TAlgGenetico::getMaxTempoMutacao ()    { return VP_maxTempoMutacao; }
+int TAlgGenetico::getTemperaturaSA ()      { return VP_temperaturaSA; }
+int TAlgGenetico::getResfriamentoSA ()     { return VP_resfriamentoSA; }
+int TAlgGenetico::getIteracoesSA ()        { return VP_iteracoesSA; }
+int TAlgGenetico::getFilhosEAX ()          { return VP_filhosEAX; }
+int TAlgGenetico::getEstrategiaEAX ()      { return VP_estrategiaEAX; }
+int TAlgGenetico::getPodaFilhos ()         { return VP_podaFilhos; }
+int TAlgGenetico::getTamTorneio ()         { return VP_tamTorneio; }
+int TAlgGenetico::getModoAG ()             { return VP_modoAG; }
 
 
 //Métodos
@@ -59,6 +85,19 @@ TAlgGenetico::TAlgGenetico (TMapaGenes *mapa, TArqLog *arqSaida)
    VP_Mapa = mapa;
    VP_ArqSaida = arqSaida;
    VP_profundidade = 0;
+   VP_numCandidatos = 8;
+   VP_modoAG = 0;
+   VP_tamTorneio = 0;
+   VP_podaFilhos = 0;
+   VP_estrategiaEAX = 0;
+   VP_filhosEAX = 10;
+   VP_iteracoesSA = 5000;
+   VP_resfriamentoSA = 9990;
+   VP_temperaturaSA = 0;
+   VP_maxTempoMutacao = 0;
+   VP_maxAvaliacoes = 0;
+   VP_numThreads = 0;
+   VP_profundidadeLK = 5;
 }
 
 TAlgGenetico::TAlgGenetico (TMapaGenes *mapa, TArqLog *arqSaida, int profundidade)
@@ -66,6 +105,19 @@ TAlgGenetico::TAlgGenetico (TMapaGenes *mapa, TArqLog *arqSaida, int profundidad
    VP_Mapa = mapa;
    VP_ArqSaida = arqSaida;
    VP_profundidade = profundidade;
+   VP_numCandidatos = 8;
+   VP_modoAG = 0;
+   VP_tamTorneio = 0;
+   VP_podaFilhos = 0;
+   VP_estrategiaEAX = 0;
+   VP_filhosEAX = 10;
+   VP_iteracoesSA = 5000;
+   VP_resfriamentoSA = 9990;
+   VP_temperaturaSA = 0;
+   VP_maxTempoMutacao = 0;
+   VP_maxAvaliacoes = 0;
+   VP_numThreads = 0;
+   VP_profundidadeLK = 5;
 }
 
 TAlgGenetico::~TAlgGenetico ()
@@ -90,7 +142,18 @@ void TAlgGenetico::exec(TIndividuo *indBase, TTabConversao *tabConversao, int ex
    
    TIndividuo *melhor;
    mutacao = new TMutacao(getMapa(), getArqLog(), getMutacao());
+   mutacao->setNumCandidatos(getNumCandidatos());
+   mutacao->setMaxTempoMutacao(getMaxTempoMutacao());
+   mutacao->setMaxAvaliacoes(getMaxAvaliacoes());
+   mutacao->setNumThreads(getNumThreads());
+   mutacao->setProfundidadeLK(getProfundidadeLK());
+   mutacao->setTemperaturaSA(getTemperaturaSA());
+   mutacao->setResfriamentoSA(getResfriamentoSA());
+   mutacao->setIteracoesSA(getIteracoesSA());
    cruzamento = new TCruzamento(getMapa(), getArqLog(), getCruzamento());
+   cruzamento->setNumCandidatos(getNumCandidatos());
+   cruzamento->setEstrategiaEAX(getEstrategiaEAX());
+   cruzamento->setFilhosEAX(getFilhosEAX());
    
    int tam = getTamPopulacao();
    if (tam>2*tabConversao->get_quantidade()) tam=2*tabConversao->get_quantidade();
@@ -100,6 +163,7 @@ void TAlgGenetico::exec(TIndividuo *indBase, TTabConversao *tabConversao, int ex
    populacao->povoa(tc, extraPadrao);
    melhor = populacao->get_melhor();
    populacao->ordena();
+   VP_popReserva = new TPopulacao (tam, getMapa(), getArqLog());
    	   
    double mdAtu = melhor->get_distancia();
    
@@ -118,18 +182,31 @@ void TAlgGenetico::exec(TIndividuo *indBase, TTabConversao *tabConversao, int ex
    
    tc.clear();
    delete populacao;
+   delete VP_popReserva;
 }
    
 void TAlgGenetico::exec()
 {
    TIndividuo *melhor;
    mutacao = new TMutacao(getMapa(), getArqLog(), getMutacao());
+   mutacao->setNumCandidatos(getNumCandidatos());
+   mutacao->setMaxTempoMutacao(getMaxTempoMutacao());
+   mutacao->setMaxAvaliacoes(getMaxAvaliacoes());
+   mutacao->setNumThreads(getNumThreads());
+   mutacao->setProfundidadeLK(getProfundidadeLK());
+   mutacao->setTemperaturaSA(getTemperaturaSA());
+   mutacao->setResfriamentoSA(getResfriamentoSA());
+   mutacao->setIteracoesSA(getIteracoesSA());
    cruzamento = new TCruzamento(getMapa(), getArqLog(), getCruzamento());
+   cruzamento->setNumCandidatos(getNumCandidatos());
+   cruzamento->setEstrategiaEAX(getEstrategiaEAX());
+   cruzamento->setFilhosEAX(getFilhosEAX());
 
    VP_melhor_dist = infinito;
    TPopulacao *populacao = new TPopulacao (getTamPopulacao(), getMapa(), getArqLog());
    populacao->povoa();
    populacao->ordena();
+   VP_popReserva = new TPopulacao (getTamPopulacao(), getMapa(), getArqLog());
 /*************
 TIndividuo *i1 = populacao->get_individuo(0);
 TIndividuo *i2 = populacao->get_individuo(1);
@@ -161,6 +238,7 @@ return;*/
       cout << endl;
    }
 
+   mutacao->registraEstatisticas();
    delete mutacao;
    delete cruzamento;
 
@@ -191,19 +269,37 @@ return;*/
    VP_ArqSaida->addLinha("");
    
    delete populacao;
+   delete VP_popReserva;
 }
 
 TPopulacao *TAlgGenetico::iteracao (TPopulacao *populacao, int geracao)
 {
-   TPopulacao *novaPop = new TPopulacao(populacao->get_tamanho(), populacao->getMapa(), populacao->getArqLog());
-   elitismo(novaPop, populacao);
-   geraDescendentes(novaPop, populacao);
+   TPopulacao *novaPop;
 
-   fazMutacao(novaPop);
+   if (getModoAG()==1)
+   {
+      //A mesma população é atualizada no lugar
+      novaPop = populacao;
+      steadyState(novaPop);
+   }
+   else
+   {
+      //As duas populações trocam de papel a cada geração. Os indivíduos
+      //da que sai vão para a reserva e são reaproveitados na próxima
+      novaPop = VP_popReserva;
+      elitismo(novaPop, populacao);
+      geraDescendentes(novaPop, populacao);
 
-   novaPop->ordena();
+      fazMutacao(novaPop);
 
-   delete populacao;
+      populacao->esvazia();
+      VP_popReserva = populacao;
+   }
+
+   //Só a roleta por posição usa a ordem completa. Nos demais casos
+   //bastam o melhor, o pior e os candidatos ao elitismo
+   if (getRoleta()==2) novaPop->ordena();
+   else novaPop->ordena(novaPop->get_tamanho() * getPercentElitismo() / 100 + 1);
 
    time(&sysTime2);
    TIndividuo *melhor = novaPop->get_melhor();  
@@ -230,6 +326,10 @@ TPopulacao *TAlgGenetico::iteracao (TPopulacao *populacao, int geracao)
    VP_ArqSaida->addTexto(to_string (pior->get_distancia()));
    VP_ArqSaida->addTexto(";Media;");
    VP_ArqSaida->addTexto(to_string(novaPop->distanciaMedia()));
+   VP_ArqSaida->addTexto(";Arestas;");
+   VP_ArqSaida->addTexto(to_string(novaPop->get_qtdeArestas()));
+   VP_ArqSaida->addTexto(";Entropia;");
+   VP_ArqSaida->addTexto(to_string(novaPop->entropiaArestas()));
    VP_ArqSaida->addTexto(";Tempo;");
    VP_ArqSaida->addLinha(to_string(difftime(sysTime2, sysTime1)));
 
@@ -250,7 +350,7 @@ void TAlgGenetico::elitismo(TPopulacao *novaPop, TPopulacao *populacao)
       if (individuo->get_distancia()!=tamAnt)
       {
          tamAnt = individuo->get_distancia();
-         novaPop->add_individuo(individuo->clona());
+         novaPop->add_individuo(novaPop->clona(individuo));
       }
       i++;
    }
@@ -263,6 +363,19 @@ void TAlgGenetico::geraDescendentes(TPopulacao *novaPop, TPopulacao *populacao)
    TIndividuo *ind1;
    TIndividuo *ind2;
 
+   //Guias do inver-over e reserva de onde saem os filhos
+   cruzamento->setPopulacao(populacao);
+   cruzamento->setDestino(novaPop);
+
+   //Com a poda, os cruzamentos construtivos abandonam o filho que não
+   //pode superar o pior da população. Depois de tantas tentativas
+   //seguidas sem filho quanto o tamanho da população, a poda é
+   //desligada até o fim da geração
+   unsigned abortos = 0;
+   cruzamento->setLimite(getPodaFilhos() ? populacao->get_pior()->get_distancia() : 0);
+
+   if ((getRoleta())&&(getTamTorneio()<=0)) montaRoleta(populacao);
+
    while (novaPop->get_qtdeIndividuo()<novaPop->get_tamanho())
    {
       i = sorteiaPais(populacao);
@@ -273,7 +386,7 @@ void TAlgGenetico::geraDescendentes(TPopulacao *novaPop, TPopulacao *populacao)
 
       if (ind1->get_distancia()==ind2->get_distancia())
       {
-         ind1 = ind2->clona();
+         ind1 = novaPop->clona(ind2);
 		 //ind1->inverte_sub_indice(TUtils::rnd(1, ind1->get_qtdeGenes()-1), TUtils::rnd(1, ind1->get_qtdeGenes()-1));
          //ind1->embaralha();
          //mutacao->processa(ind1);
@@ -281,12 +394,92 @@ void TAlgGenetico::geraDescendentes(TPopulacao *novaPop, TPopulacao *populacao)
       }
       else
 	  {
-		  novaPop->add_individuo(cruzamento->processa(ind1, ind2));
+		  vector <TIndividuo *> filhos = cruzamento->processa(ind1, ind2);
+		  if (!filhos.empty()) abortos = 0;
+		  else if (++abortos>=populacao->get_tamanho()) cruzamento->setLimite(0);
+		  novaPop->add_individuo(filhos);
 	  }
          
    }
 }
 
+/**
+ *
+ * AG steady-state
+ *
+ * Whitley (1989). The GENITOR Algorithm and Selection Pressure: Why
+ * Rank-Based Allocation of Reproductive Trials is Best. Proceedings of
+ * the 3rd International Conference on Genetic Algorithms, 116–121.
+ *
+ * Cada passo sorteia os pais, gera os filhos, aplica a mutação com a
+ * probabilidade percentMutacao e coloca cada filho no lugar do pior da
+ * população, quando é melhor do que ele e não repete a distância de
+ * outro indivíduo. O pior fica na raiz de um heap, então cada troca
+ * custa O(log n). Uma geração equivale a tamanho passos.
+ *
+ **/
+void TAlgGenetico::steadyState(TPopulacao *populacao)
+{
+   unsigned abortos = 0;
+
+   cruzamento->setPopulacao(populacao);
+   cruzamento->setDestino(populacao);
+   cruzamento->setLimite(0);
+
+   //A população chega ordenada, os pesos valem para toda a geração
+   if ((getRoleta())&&(getTamTorneio()<=0)) montaRoleta(populacao);
+   populacao->montaHeap();
+
+   for (unsigned passo=0; passo<populacao->get_tamanho(); passo++)
+   {
+      if ((getPodaFilhos())&&(abortos<populacao->get_tamanho()))
+         cruzamento->setLimite(populacao->get_piorHeap()->get_distancia());
+
+      int i = sorteiaPais(populacao);
+      int j = sorteiaPais(populacao, i);
+
+      TIndividuo *ind1 = populacao->get_individuo(i);
+      TIndividuo *ind2 = populacao->get_individuo(j);
+
+      vector <TIndividuo *> filhos;
+      if (ind1->get_distancia()==ind2->get_distancia()) filhos.push_back(populacao->clona(ind2));
+      else
+      {
+         filhos = cruzamento->processa(ind1, ind2);
+         if (!filhos.empty()) abortos = 0;
+         else if (++abortos>=populacao->get_tamanho()) cruzamento->setLimite(0);
+      }
+
+      for (TIndividuo *filho : filhos)
+      {
+         if ((!getAtivaRecursivo())&&(TUtils::rnd(1, 100)<=getPercentMutacao()))
+            mutacao->processa(filho);
+
+         if ((filho->get_distancia()>=populacao->get_piorHeap()->get_distancia())||(populacao->temDistancia(filho->get_distancia())))
+         {
+            populacao->descarta(filho);
+            continue;
+         }
+
+         unsigned pos = populacao->substituiPior(filho);
+
+         //A mutação recursiva trabalha sobre um indivíduo da população
+         if ((getAtivaRecursivo())&&(TUtils::rnd(1, 100)<=getPercentMutacao()))
+         {
+            double anterior = filho->get_distancia();
+            populacao->sub_dist_tot(anterior);
+            populacao->retiraArestas(filho);
+            mutacaoAGRecursivo(populacao, pos);
+            //Quando supera o melhor, o filho troca de lugar com ele
+            if (populacao->get_individuo(pos)!=filho) pos = 0;
+            populacao->soma_dist_tot(filho->get_distancia());
+            populacao->incluiArestas(filho);
+            populacao->atualizaHeap(pos, anterior);
+         }
+      }
+   }
+}
+
 void TAlgGenetico::fazMutacao(TPopulacao *populacao)
 {
    int ini=0;
@@ -302,8 +495,10 @@ void TAlgGenetico::fazMutacao(TPopulacao *populacao)
       case 1:  //O melhor sempre sofre mutação
       {
          populacao->sub_dist_tot((populacao->get_individuo(0))->get_distancia());
+         populacao->retiraArestas(populacao->get_individuo(0));
          mutacao->processa(populacao->get_individuo(0));
          populacao->soma_dist_tot((populacao->get_individuo(0))->get_distancia());
+         populacao->incluiArestas(populacao->get_individuo(0));
          ini = 1;
          qtdeMutacao--;
          break;
@@ -318,16 +513,20 @@ void TAlgGenetico::fazMutacao(TPopulacao *populacao)
    {
       int j = TUtils::rnd (ini, populacao->get_tamanho()-1);
 
-      populacao->sub_dist_tot((populacao->get_individuo(j))->get_distancia());
+      //A mutação recursiva pode trocar o indivíduo de posição com o melhor
+      TIndividuo *individuo = populacao->get_individuo(j);
+      populacao->sub_dist_tot(individuo->get_distancia());
+      populacao->retiraArestas(individuo);
 
       if (getAtivaRecursivo())
 	  {
          mutacaoAGRecursivo(populacao, j);
       }		 
       else
-         mutacao->processa(populacao->get_individuo(j));
+         mutacao->processa(individuo);
 
-      populacao->soma_dist_tot((populacao->get_individuo(j))->get_distancia());
+      populacao->soma_dist_tot(individuo->get_distancia());
+      populacao->incluiArestas(individuo);
    }
 }
 
@@ -336,44 +535,42 @@ int TAlgGenetico::sorteiaPais(TPopulacao *populacao)
    return sorteiaPais (populacao, -1);
 }
 
+//Pesos da roleta a partir da população ordenada da geração
+void TAlgGenetico::montaRoleta(TPopulacao *populacao)
+{
+   unsigned n = populacao->get_tamanho();
+   vector<double> pesos (n);
+
+   for (unsigned i=0; i<n; i++)
+   {
+      if (getRoleta()==2) pesos[i] = n-i;
+      else pesos[i] = 1/populacao->get_individuo(i)->get_distancia();
+   }
+
+   VP_roletaPais.monta(pesos);
+}
+
 int TAlgGenetico::sorteiaPais(TPopulacao *populacao, int exceto)
 {
-   unsigned i;
    int escolha;
    int maximo = populacao->get_tamanho()-1;
 
-   //Variaveis para a busca binária
-   int ini, fim, meio;
-
-   if (getRoleta()) { maximo = populacao->get_soma_dist()-1; }
-
    do
    {
-      i = TUtils::rnd(0, maximo);
-      /**********************************************/
-      /**********************************************/
-      // O sorteio com peso não está legal, refazer
-      /**********************************************/
-      if (getRoleta())
+      //Torneio: o melhor entre tamTorneio sorteados
+      if (getTamTorneio()>0)
       {
-         //Busca binária
-         ini = 0; fim =populacao->get_tamanho()-1;
-         meio = ini + ((fim-ini)/2);
-         do
+         escolha = TUtils::rnd(0, maximo);
+         for (int t=1; t<getTamTorneio(); t++)
          {
-            if (i<(populacao->get_individuo(meio))->get_distancia()) fim = meio;
-            else ini = meio+1;
-
-            meio = ini + ((fim-ini)/2);
-
-         }while((meio>ini)||(meio<fim));
-         escolha = meio;
+            int i = TUtils::rnd(0, maximo);
+            if (populacao->get_individuo(i)->get_distancia()<populacao->get_individuo(escolha)->get_distancia()) escolha = i;
+         }
       }
-      /**********************************************/
-      /**********************************************/
-
+      else if (getRoleta())
+         escolha = VP_roletaPais.sorteia();
       else
-         escolha = i;
+         escolha = TUtils::rnd(0, maximo);
 
    }while (escolha==exceto);
 
@@ -386,27 +583,14 @@ void TAlgGenetico::mutacaoAGRecursivo(TPopulacao *populacao, int indice)
    TTabConversao *tabConversao;
 
    int qtdeGenes;
-   long esforco;
-   long fatorial;
 
    TIndividuo *melhor = populacao->get_melhor();
    TIndividuo *manipulado = populacao->get_individuo(indice);
 
-   //Verifico se o esforço
-   //(poulação (cruzamento + elitismo))* Número de gerações * (população * %mutação)
-   esforco = (populacao->get_tamanho() * getPercentMutacao()/100) * getMaxGeracao() * populacao->get_tamanho();
-
-   //So o fatorial for <= 0 é porque houve overflow
-   //-1, pois como é um ciclo, é possível fixar o 0
-   fatorial = TUtils::fatorialStirling(manipulado->get_qtdeGenes()-1);
-
-   //é maior do que todas as combinações (fatorial) da quantidade de gene
-   //Se a combinação for maior, realiza o AG com os novos genes.
-   //Obs.: o fatorial deve ser > 0, pois provavelmente irá estourar o long
-   if ((fatorial>0)&&(esforco>=fatorial))
+   //Com poucos genes, a melhor combinação é obtida pela programação
+   //dinâmica (Held-Karp), O(n^2 * 2^n), bem mais rápido que outro AG
+   if (manipulado->get_qtdeGenes()<=maxGenesPD)
    {
-      //Quando o esforço é maior que as combinações
-      //O melhor indivuo por combinação
 	  manipulado->melhorPossivel();
 
 	  if (manipulado->get_distancia()<melhor->get_distancia())
@@ -437,6 +621,38 @@ void TAlgGenetico::mutacaoAGRecursivo(TPopulacao *populacao, int indice)
 
    }while (qtdeGenes<=2);
 
+   //Se a redução for suficiente, resolve o indivíduo reduzido
+   //pela programação dinâmica ou pelo branch-and-bound
+   if (qtdeGenes<=maxGenesBB)
+   {
+      TIndividuo *reduzido = new TIndividuo(getMapa(), getArqLog());
+      reduzido->novo(tabConversao->get_vetConv(), melhor->get_extra());
+      if (qtdeGenes<=maxGenesPD) reduzido->melhorPossivel();
+      else
+      {
+         TExato exato(getMapa());
+         exato.branchBound(reduzido, maxNosBB);
+      }
+      tabConversao->converte(manipulado, reduzido);
+      delete reduzido;
+
+      if (manipulado->get_distancia()<melhor->get_distancia())
+      {
+         populacao->troca(0, indice);
+         string lin = "Melhorou na combinação reduzida ;";
+         lin += to_string(qtdeGenes);
+         if (getPrintParcial()) cout << endl << lin << endl;
+         VP_ArqSaida->addLinha(lin);
+      }
+      else if (manipulado->get_distancia()==melhor->get_distancia())
+      {
+         manipulado->inverte_sub_indice(TUtils::rnd(1, manipulado->get_qtdeGenes()-1), TUtils::rnd(1, manipulado->get_qtdeGenes()-1));
+      }
+
+      //Libera memória
+      delete tabConversao;
+      return;
+   }
 
    // Se não reduzir, não faz nada
    if (qtdeGenes >= getPercentReducao()*0.01*manipulado->get_qtdeGenes())
@@ -460,6 +676,19 @@ void TAlgGenetico::mutacaoAGRecursivo(TPopulacao *populacao, int indice)
    ag->setSelIndMutacao(getSelIndMutacao());
    ag->setAtivaRecursivo(getAtivaRecursivo());
    ag->setPercentReducao(getPercentReducao());
+   ag->setNumCandidatos(getNumCandidatos());
+   ag->setProfundidadeLK(getProfundidadeLK());
+   ag->setNumThreads(getNumThreads());
+   ag->setMaxAvaliacoes(getMaxAvaliacoes());
+   ag->setMaxTempoMutacao(getMaxTempoMutacao());
+   ag->setTemperaturaSA(getTemperaturaSA());
+   ag->setResfriamentoSA(getResfriamentoSA());
+   ag->setIteracoesSA(getIteracoesSA());
+   ag->setFilhosEAX(getFilhosEAX());
+   ag->setEstrategiaEAX(getEstrategiaEAX());
+   ag->setPodaFilhos(getPodaFilhos());
+   ag->setTamTorneio(getTamTorneio());
+   ag->setModoAG(getModoAG());
    ag->setTime(sysTime1);
    ag->exec(manipulado, tabConversao, melhor->get_extra());
 
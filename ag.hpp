@@ -21,6 +21,8 @@
 #include "populacao.hpp"
 #include "utils.hpp"
 #include "tabconversao.hpp"
+#include "exato.hpp"
+#include "roleta.hpp"
 
 
 class TAlgGenetico
@@ -43,6 +45,19 @@ class TAlgGenetico
       int VP_percentReducao;
       int VP_profundidadeMaxima;
       int VP_ativaRecursivo;
+      int VP_numCandidatos;
+      int VP_profundidadeLK;
+      int VP_numThreads;
+      int VP_maxAvaliacoes;
+      int VP_maxTempoMutacao;
+      int VP_temperaturaSA;
+      int VP_resfriamentoSA;
+      int VP_iteracoesSA;
+      int VP_filhosEAX;
+      int VP_estrategiaEAX;
+      int VP_podaFilhos;
+      int VP_tamTorneio;
+      int VP_modoAG;
 
 
       double VP_melhor_dist;
@@ -51,6 +66,13 @@ class TAlgGenetico
       TMapaGenes *VP_Mapa;
       TArqLog *VP_ArqSaida;
 
+      //A população seguinte é montada sobre esta, que guarda na
+      //reserva os indivíduos de duas gerações atrás
+      TPopulacao *VP_popReserva;
+
+      //Roleta dos pais, montada no início de cada geração
+      TRoleta VP_roletaPais;
+
    public:      
       TMutacao *mutacao;
       TCruzamento *cruzamento;
@@ -76,6 +98,19 @@ class TAlgGenetico
       void setPercentReducao (int val);
 	  void setProfundidadeMaxima(int val);
       void setAtivaRecursivo (int val);
+      void setNumCandidatos (int val);
+      void setProfundidadeLK (int val);
+      void setNumThreads (int val);
+      void setMaxAvaliacoes (int val);
+      void setMaxTempoMutacao (int val);
+      void setTemperaturaSA (int val);
+      void setResfriamentoSA (int val);
+      void setIteracoesSA (int val);
+      void setFilhosEAX (int val);
+      void setEstrategiaEAX (int val);
+      void setPodaFilhos (int val);
+      void setTamTorneio (int val);
+      void setModoAG (int val);
 
       int getPercentReducao ();
 	  int getProfundidadeMaxima();
@@ -90,6 +125,19 @@ class TAlgGenetico
       int getPercentElitismo ();
       int getRoleta ();
       int getSelIndMutacao ();
+      int getNumCandidatos ();
+      int getProfundidadeLK ();
+      int getNumThreads ();
+      int getMaxAvaliacoes ();
+      int getMaxTempoMutacao ();
+      int getTemperaturaSA ();
+      int getResfriamentoSA ();
+      int getIteracoesSA ();
+      int getFilhosEAX ();
+      int getEstrategiaEAX ();
+      int getPodaFilhos ();
+      int getTamTorneio ();
+      int getModoAG ();
 
       void setTime (time_t sTime);
       //Métodos
@@ -103,7 +151,9 @@ class TAlgGenetico
       TPopulacao *iteracao (TPopulacao *populacao, int geracao);
       void elitismo(TPopulacao *novaPop, TPopulacao *populacao);
       void geraDescendentes(TPopulacao *novaPop, TPopulacao *populacao);
+      void steadyState(TPopulacao *populacao);
       void fazMutacao(TPopulacao *populacao);
+      void montaRoleta(TPopulacao *populacao);
       int sorteiaPais(TPopulacao *populacao, int exceto);
       int sorteiaPais(TPopulacao *populacao);
       void mutacaoAGRecursivo(TPopulacao *populacao, int indice);
@@ -0,0 +1,69 @@
+/*
+*  candidatos.cpp
+*
+*  Módulo responsável pelas listas de vizinhos candidatos de cada gene,
+*  utilizadas pelas buscas locais
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#include "candidatos.hpp"
+
+TListaCandidatos::TListaCandidatos (TMapaGenes *mapa)
+{
+   VP_Mapa = mapa;
+   VP_n = 0;
+   VP_k = 0;
+}
+
+int TListaCandidatos::get_k () { return VP_k; }
+
+bool TListaCandidatos::mesmosGenes (TIndividuo *individuo)
+{
+   if (individuo->get_qtdeGenes()!=VP_n) return false;
+
+   for (int i=0; i<VP_n; i++)
+   {
+      TGene *g = individuo->get_por_id(i);
+      if ((g->ori!=VP_ori[i])||(g->dest!=VP_dest[i])) return false;
+   }
+   return true;
+}
+
+void TListaCandidatos::monta (TIndividuo *individuo, int k)
+{
+   VP_n = individuo->get_qtdeGenes();
+   if (k>VP_n-1) k = VP_n-1;
+   VP_k = k;
+
+   VP_ori.resize(VP_n);
+   VP_dest.resize(VP_n);
+   for (int i=0; i<VP_n; i++)
+   {
+      VP_ori[i]  = individuo->get_por_id(i)->ori;
+      VP_dest[i] = individuo->get_por_id(i)->dest;
+   }
+
+   VP_vizinhos.resize(VP_n*VP_k);
+
+   vector<int> todos (VP_n-1);
+   vector<double> dist (VP_n);
+   for (int a=0; a<VP_n; a++)
+   {
+      for (int b=0, j=0; b<VP_n; b++)
+      {
+         dist[b] = VP_Mapa->get_distancia(VP_ori[a], VP_dest[b]);
+         if (b!=a) todos[j++] = b;
+      }
+
+      //Apenas os k primeiros precisam ficar ordenados
+      partial_sort(todos.begin(), todos.begin()+VP_k, todos.end(),
+                   [&](int x, int y) { return dist[x] < dist[y]; });
+
+      for (int j=0; j<VP_k; j++) VP_vizinhos[a*VP_k+j] = todos[j];
+   }
+}
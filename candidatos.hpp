@@ -0,0 +1,52 @@
+/*
+*  candidatos.hpp
+*
+*  Módulo responsável pelas listas de vizinhos candidatos de cada gene,
+*  utilizadas pelas buscas locais
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#ifndef _CANDIDATOS_H
+#define	_CANDIDATOS_H
+
+#include <vector>
+#include "individuo.hpp"
+#include "tsp.hpp"
+
+/*************************************************************
+Os k genes mais próximos de cada gene, em ordem crescente de
+distância, guardados em um único vetor de n*k posições
+*************************************************************/
+class TListaCandidatos
+{
+   private:
+      TMapaGenes *VP_Mapa;
+
+      int VP_n;
+      int VP_k;
+      vector<int> VP_vizinhos;
+
+      //Assinatura dos genes (ori/dest) usados para montar a lista
+      vector<int> VP_ori;
+      vector<int> VP_dest;
+
+   public:
+      TListaCandidatos (TMapaGenes *mapa);
+
+      int get_k ();
+
+      //Monta a lista para os genes do indivíduo
+      void monta (TIndividuo *individuo, int k);
+      //Se o indivíduo tem os mesmos genes da lista montada
+      bool mesmosGenes (TIndividuo *individuo);
+
+      //Vetor com os k vizinhos do gene
+      int *vizinhos (int id) { return &VP_vizinhos[id*VP_k]; }
+};
+
+#endif
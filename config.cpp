@@ -40,6 +40,19 @@ void TConfig::leInfo(xmlDocPtr doc, xmlNode * a_node)
          else if (!xmlStrcmp(cur_node->name, (xmlChar *)"roleta")) roleta = val;
          else if (!xmlStrcmp(cur_node->name, (xmlChar *)"selIndMutacao")) selIndMutacao = val;
 		 else if (!xmlStrcmp(cur_node->name, (xmlChar *)"profundidadeMaxima")) profundidadeMaxima = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"numCandidatos")) numCandidatos = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"profundidadeLK")) profundidadeLK = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"numThreads")) numThreads = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"maxAvaliacoes")) maxAvaliacoes = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"maxTempoMutacao")) maxTempoMutacao = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"temperaturaSA")) temperaturaSA = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"resfriamentoSA")) resfriamentoSA = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"iteracoesSA")) iteracoesSA = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"filhosEAX")) filhosEAX = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"estrategiaEAX")) estrategiaEAX = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"podaFilhos")) podaFilhos = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"tamTorneio")) tamTorneio = val;
+         else if (!xmlStrcmp(cur_node->name, (xmlChar *)"modoAG")) modoAG = val;
 
       }
 
@@ -62,6 +75,19 @@ TConfig::TConfig()
    percentReducao = 75;
    percentElitismo = 70;
    profundidadeMaxima = 5;
+   numCandidatos = 8;
+   profundidadeLK = 5;
+   numThreads = 0;
+   maxAvaliacoes = 0;
+   maxTempoMutacao = 0;
+   temperaturaSA = 0;
+   resfriamentoSA = 9990;
+   iteracoesSA = 5000;
+   filhosEAX = 10;
+   estrategiaEAX = 0;
+   podaFilhos = 0;
+   tamTorneio = 0;
+   modoAG = 0;
 }
 
 void TConfig::carregaDoArquivo(char *nomeArquivo)
@@ -35,7 +35,7 @@ class TConfig
       int numExec;              //número de execuções
       int tamPopulacao;
       int maxGeracao;
-      int mutacao;              //mutação base a ser realzada
+      int mutacao;              //mutação base a ser realzada (11 = escolha adaptativa)
       int cruzamento;           //cruzamento base a ser realizado
       int percentManipulacao;   //percentual de manipulação do indivíduo. (exclusão / cruzamento)
       int percentMutacao;       //percentual de mutação
@@ -45,10 +45,26 @@ class TConfig
       int percentReducao;       //percentual de redução do gene a cada recursvidade
       int percentElitismo;      //Percentual de elitismo
       int roleta;               //Se ativa ou não o sorteio do cruzamento de formatendencosa
+                                //  0 - sorteio uniforme
+                                //  1 - peso pelo inverso da distância
+                                //  2 - peso pela posição na população ordenada
       int selIndMutacao;        //Seleção do individuos para mutacçao
                                 //  0 - o melhor individuo nunca é selecionado
                                 //  1 - o melhor individuo sempre é seleconado
                                 //  2 - seleção do melhor individuo é aleatória
+      int numCandidatos;        //Vizinhos candidatos de cada gene nas buscas locais
+      int profundidadeLK;       //Níveis do Lin-Kernighan (mutação 9)
+      int numThreads;           //Threads na varredura do 2-opt e 3-opt (0 = todos os núcleos)
+      int maxAvaliacoes;        //Avaliações de movimentos por chamada da mutação (0 = sem limite)
+      int maxTempoMutacao;      //Microssegundos por chamada da mutação (0 = sem limite)
+      int temperaturaSA;        //Temperatura inicial do simulated annealing (0 = automática)
+      int resfriamentoSA;       //Fator de resfriamento do SA por proposta, em 1/10000
+      int iteracoesSA;          //Propostas do simulated annealing por chamada
+      int filhosEAX;            //Filhos gerados pelo EAX, fica o melhor (cruzamento 3)
+      int estrategiaEAX;        //Seleção dos ciclos AB do EAX (0 = single, 1 = bloco)
+      int podaFilhos;           //Aborta o filho que não pode superar o pior da população (0/1)
+      int tamTorneio;           //Indivíduos por torneio na seleção dos pais (0 = roleta)
+      int modoAG;               //Modo do AG (0 = geracional, 1 = steady-state)
 
       /*******************************************************
            Os valores padrões são os utilizados no artigo
@@ -17,11 +17,35 @@
 TMapaGenes *TCruzamento::getMapa() { return VP_Mapa; }
 TArqLog *TCruzamento::getArqLog()  { return VP_ArqSaida; }
 
+void TCruzamento::setNumCandidatos (int val) { VP_numCandidatos = val; }
+int TCruzamento::getNumCandidatos ()         { return VP_numCandidatos; }
+void TCruzamento::setEstrategiaEAX (int val) { VP_estrategiaEAX = val; }
+int TCruzamento::getEstrategiaEAX ()         { return VP_estrategiaEAX; }
+void TCruzamento::setFilhosEAX (int val)     { VP_filhosEAX = val; }
+int TCruzamento::getFilhosEAX ()             { return VP_filhosEAX; }
+void TCruzamento::setPopulacao (TPopulacao *populacao) { VP_Populacao = populacao; }
+void TCruzamento::setDestino (TPopulacao *destino)      { VP_Destino = destino; }
+void TCruzamento::setLimite (double val)     { VP_limite = val; }
+double TCruzamento::getLimite ()             { return VP_limite; }
+
 TCruzamento::TCruzamento (TMapaGenes *mapa, TArqLog *arqSaida, int tipoCruzamento)
 {
    VP_Mapa = mapa;
    VP_ArqSaida = arqSaida;
    VP_cruzamento = tipoCruzamento;
+   VP_numCandidatos = 8;
+   VP_estrategiaEAX = 0;
+   VP_filhosEAX = 10;
+   VP_Candidatos = NULL;
+   VP_Populacao = NULL;
+   VP_Destino = NULL;
+   VP_limite = 0;
+   VP_somaMinSaida = 0;
+}
+
+TCruzamento::~TCruzamento ()
+{
+   if (VP_Candidatos) delete VP_Candidatos;
 }
 
 vector <TIndividuo *>TCruzamento::processa (TIndividuo *parceiro1, TIndividuo *parceiro2)
@@ -45,6 +69,27 @@ vector <TIndividuo *>TCruzamento::processa (TIndividuo *parceiro1, TIndividuo *p
       }
       case 3:
       {
+         return EAX(parceiro1, parceiro2);
+         break;
+      }
+      case 4:
+      {
+         return DPX(parceiro1, parceiro2);
+         break;
+      }
+      case 5:
+      {
+         return ER(parceiro1, parceiro2);
+         break;
+      }
+      case 6:
+      {
+         return InverOver(parceiro1, parceiro2);
+         break;
+      }
+      case 7:
+      {
+         return GPX(parceiro1, parceiro2);
          break;
       }
       default:
@@ -54,8 +99,8 @@ vector <TIndividuo *>TCruzamento::processa (TIndividuo *parceiro1, TIndividuo *p
    }
 
    vector <TIndividuo *> filhos;
-   filhos.push_back(parceiro1->clona());
-   filhos.push_back(parceiro2->clona());
+   filhos.push_back(clona(parceiro1));
+   filhos.push_back(clona(parceiro2));
    return filhos;
 }
 
@@ -79,8 +124,17 @@ vector <TIndividuo *>TCruzamento::GSTX(TIndividuo *parceiro1, TIndividuo *parcei
 
    vector<TGene *> temp;
    vector<bool> controle (parceiro1->get_qtdeGenes(), true);
+   vector <TIndividuo *> filhos;
 
-   TIndividuo *filho = new TIndividuo(VP_Mapa, VP_ArqSaida);
+   //Distância parcial e soma das menores saídas dos genes que faltam
+   bool poda = VP_limite>0;
+   double parcial = 0;
+   double restante = 0;
+   if (poda)
+   {
+      candidatos(parceiro1);
+      restante = VP_somaMinSaida;
+   }
 
    int pivo =  TUtils::rnd(1, parceiro1->get_qtdeGenes()-1);
    gPar1 = parceiro1->get_por_indice(pivo);
@@ -88,6 +142,7 @@ vector <TIndividuo *>TCruzamento::GSTX(TIndividuo *parceiro1, TIndividuo *parcei
 
    temp.push_back (gPar1);
    controle[gPar1->id] = false;
+   if (poda) restante -= VP_minSaida[gPar1->id];
 
    bool dir = true;
    bool esq = true;
@@ -103,6 +158,11 @@ vector <TIndividuo *>TCruzamento::GSTX(TIndividuo *parceiro1, TIndividuo *parcei
             gPar1 = parceiro1->ant(gPar1);
             if (controle[gPar1->id])
             {
+               if (poda)
+               {
+                  parcial += VP_Mapa->get_distancia(gPar1->ori, temp.front()->dest);
+                  restante -= VP_minSaida[gPar1->id];
+               }
                temp.insert(temp.begin(),gPar1);
                controle[gPar1->id] = false;
                i++;
@@ -118,6 +178,11 @@ vector <TIndividuo *>TCruzamento::GSTX(TIndividuo *parceiro1, TIndividuo *parcei
             gPar2 = parceiro2->prox(gPar2);
             if (controle[gPar2->id])
             {
+               if (poda)
+               {
+                  parcial += VP_Mapa->get_distancia(temp.back()->ori, gPar2->dest);
+                  restante -= VP_minSaida[gPar2->id];
+               }
                temp.push_back (gPar2);
                controle[gPar2->id] = false;
                i++;
@@ -130,6 +195,11 @@ vector <TIndividuo *>TCruzamento::GSTX(TIndividuo *parceiro1, TIndividuo *parcei
          gPar1 = parceiro1->ant(gPar1);
          if (controle[gPar1->id])
          {
+            if (poda)
+            {
+               parcial += VP_Mapa->get_distancia(temp.back()->ori, gPar1->dest);
+               restante -= VP_minSaida[gPar1->id];
+            }
             temp.push_back (gPar1);
             controle[gPar1->id] = false;
             i++;
@@ -138,19 +208,27 @@ vector <TIndividuo *>TCruzamento::GSTX(TIndividuo *parceiro1, TIndividuo *parcei
          gPar2 = parceiro2->prox(gPar2->id);
          if (controle[gPar2->id])
          {
+            if (poda)
+            {
+               parcial += VP_Mapa->get_distancia(temp.back()->ori, gPar2->dest);
+               restante -= VP_minSaida[gPar2->id];
+            }
             temp.push_back (gPar2);
             controle[gPar2->id] = false;
             i++;
          }
       }
+
+      //O filho não pode superar o pior da população
+      if ((poda)&&(excede(parcial, restante, temp.back()->id))) return filhos;
    }
 
-   filho->novo(temp);
+   vector<int> ids (temp.size());
+   for (unsigned k=0; k<temp.size(); k++) ids[k] = temp[k]->id;
    controle.clear();
    temp.clear();
 
-   vector <TIndividuo *> filhos;
-   filhos.push_back(filho);
+   filhos.push_back(monta(parceiro1, parceiro2, ids));
    return filhos;
 }
 
@@ -166,29 +244,40 @@ vector <TIndividuo *>TCruzamento::GSTX(TIndividuo *parceiro1, TIndividuo *parcei
  **/
 vector <TIndividuo *>TCruzamento::PMX(TIndividuo *parceiro1, TIndividuo *parceiro2)
 {
-   int k;
-   int uInicio, uFin;
-   TGene *aux1;
-   TGene *aux2;
-   TIndividuo *filho1 = parceiro1->clona();
-   TIndividuo *filho2 = parceiro2->clona();
-
-   uInicio = TUtils::rnd(1, filho1->get_qtdeGenes()-2);
-   uFin = TUtils::rnd(uInicio+1, filho1->get_qtdeGenes()-1);
-  
+   int n = parceiro1->get_qtdeGenes();
+   vector<int> c1 (n), c2 (n), pos1 (n), pos2 (n);
+   for (int k=0; k<n; k++)
+   {
+      c1[k] = parceiro1->get_por_indice(k)->id;
+      c2[k] = parceiro2->get_por_indice(k)->id;
+      pos1[c1[k]] = k;
+      pos2[c2[k]] = k;
+   }
+
+   int uInicio = TUtils::rnd(1, n-2);
+   int uFin = TUtils::rnd(uInicio+1, n-1);
+
    //O algorítimo está diferente do contreras, porém, ele foi
-   //entendi e modificado de forma a ficar mais simples
-   for(k=uInicio; k<=uFin; k++)
+   //entendi e modificado de forma a ficar mais simples.
+   //Em cada posição do trecho, os dois genes trocam de lugar nos
+   //dois filhos, consultando as posições em O(1)
+   for (int k=uInicio; k<=uFin; k++)
    {
-      aux1 = filho1->get_por_indice(k);
-      aux2 = filho2->get_por_indice(k);
-      
-      filho1->troca(aux1->id, aux2->id);
-      filho2->troca(aux2->id, aux1->id);
+      int a = c1[k];
+      int b = c2[k];
+
+      int pb = pos1[b];
+      c1[k] = b;  pos1[b] = k;
+      c1[pb] = a; pos1[a] = pb;
+
+      int pa = pos2[a];
+      c2[k] = a;  pos2[a] = k;
+      c2[pa] = b; pos2[b] = pa;
    }
+
    vector <TIndividuo *> filhos;
-   filhos.push_back(filho1);
-   filhos.push_back(filho2);
+   filhos.push_back(monta(parceiro1, parceiro2, c1));
+   filhos.push_back(monta(parceiro1, parceiro2, c2));
    return filhos;
 }
 
@@ -203,92 +292,647 @@ vector <TIndividuo *>TCruzamento::PMX(TIndividuo *parceiro1, TIndividuo *parceir
 vector <TIndividuo *>TCruzamento::OX1(TIndividuo *parceiro1, TIndividuo *parceiro2)
 {
 	vector <TIndividuo *> filhos;
-	TIndividuo *filho1 = parceiro1->clona();
-   TIndividuo *filho2 = parceiro2->clona();
+   int n = parceiro1->get_qtdeGenes();
 
    //Para executar esse cruzamento a quantdade de genes tem 
 	// que ser maior que 3.
-	if (parceiro1->get_qtdeGenes()<=3)
+	if (n<=3)
 	{
-		filhos.push_back(filho1);
-		filhos.push_back(filho2);
+		filhos.push_back(clona(parceiro1));
+		filhos.push_back(clona(parceiro2));
 		return filhos;
 	}
 	
 	int uInicio, uFin;
-	uInicio = TUtils::rnd(1, filho1->get_qtdeGenes()-3);
-	uFin = TUtils::rnd(uInicio+1, filho1->get_qtdeGenes()-2);
-
-	//  vector <unsigned> aux = child1;
-	TGene *it1;
-	TGene *it2;
-	int j = uFin;
-	int fin_i = filho1->get_qtdeGenes();
-	int fin_j = filho2->get_qtdeGenes();
-	
-	//Filho1
-	for(int i = uFin+1; i < fin_i; i++)
-	{
-		while(j < fin_j)
-		{
-			j++;
-         if(j >= parceiro2->get_qtdeGenes())
+	uInicio = TUtils::rnd(1, n-3);
+	uFin = TUtils::rnd(uInicio+1, n-2);
+
+   TIndividuo *pais[2] = {parceiro1, parceiro2};
+   vector<int> filho (n);
+   vector<char> noTrecho (n);
+
+   for (int f=0; f<2; f++)
+   {
+      TIndividuo *pai = pais[f];
+      TIndividuo *outro = pais[1-f];
+
+      //O trecho uInicio..uFin vem do pai e o restante, a partir de
+      //uFin+1, segue a ordem do outro pai. O gene 0 fica no início
+      fill(noTrecho.begin(), noTrecho.end(), 0);
+      filho[0] = 0;
+      for (int k=uInicio; k<=uFin; k++)
+      {
+         filho[k] = pai->get_por_indice(k)->id;
+         noTrecho[filho[k]] = 1;
+      }
+
+      int i = uFin+1;
+      for (int t=0, j=uFin+1; t<n-1; t++, j++)
+      {
+         if (j>=n) j = 1;
+         int id = outro->get_por_indice(j)->id;
+         if (noTrecho[id]) continue;
+
+         filho[i] = id;
+         i = (i+1>=n)?1:i+1;
+      }
+
+      filhos.push_back(monta(parceiro1, parceiro2, filho));
+   }
+
+	return filhos;
+}
+
+/**
+ *
+ * Edge Assembly Crossover (EAX)
+ *
+ * Nagata & Kobayashi (2013). A Powerful Genetic Algorithm Using Edge
+ * Assembly Crossover for the Traveling Salesman Problem. INFORMS Journal
+ * on Computing, 25(2), 346–363.
+ *
+ * Cada filho é o melhor de até VP_filhosEAX filhos gerados a partir de
+ * um dos pais com os ciclos AB do outro. Como as sub-rotas são juntadas
+ * considerando apenas distâncias, o EAX exige custos simétricos; nos
+ * outros casos é utilizado o GSTX.
+ *
+ **/
+vector <TIndividuo *>TCruzamento::EAX(TIndividuo *parceiro1, TIndividuo *parceiro2)
+{
+   if ((parceiro1->get_qtdeGenes()<8)||(!parceiro1->simetrico())||(!parceiro2->simetrico()))
+      return GSTX(parceiro1, parceiro2);
+
+   vector <TIndividuo *> filhos;
+   vector<int> ids;
+   TEAX eax (VP_Mapa, candidatos(parceiro1));
+
+   eax.processa(parceiro1, parceiro2, VP_estrategiaEAX, VP_filhosEAX, ids);
+   filhos.push_back(monta(parceiro1, parceiro2, ids));
+   eax.processa(parceiro2, parceiro1, VP_estrategiaEAX, VP_filhosEAX, ids);
+   filhos.push_back(monta(parceiro1, parceiro2, ids));
+
+   return filhos;
+}
+
+/**
+ *
+ * Distance Preserving Crossover (DPX)
+ *
+ * Freisleben & Merz (1996). A genetic local search algorithm for solving
+ * symmetric and asymmetric traveling salesman problems. Proceedings of
+ * IEEE International Conference on Evolutionary Computation, 1996.
+ * (pp. 616–621).
+ *
+ * As arestas comuns aos dois pais formam fragmentos, encontrados em O(n)
+ * com os vetores de sucessores. Partindo de um fragmento sorteado, o fim
+ * da rota é ligado ao fragmento mais próximo entre os vizinhos candidatos,
+ * evitando as arestas dos pais, de modo que o filho fique à mesma
+ * distância dos dois. Cada filho começa de um fragmento diferente.
+ *
+ **/
+vector <TIndividuo *>TCruzamento::DPX(TIndividuo *parceiro1, TIndividuo *parceiro2)
+{
+   vector <TIndividuo *> filhos;
+   int n = parceiro1->get_qtdeGenes();
+   bool simetrico = (parceiro1->simetrico())&&(parceiro2->simetrico());
+
+   vector<int> sucA (n), antA (n), sucB (n), antB (n);
+   for (int id=0; id<n; id++)
+   {
+      sucA[id] = parceiro1->get_por_id(id)->prox->id;
+      antA[id] = parceiro1->get_por_id(id)->ant->id;
+      sucB[id] = parceiro2->get_por_id(id)->prox->id;
+      antB[id] = parceiro2->get_por_id(id)->ant->id;
+   }
+
+   //Aresta a->b presente no pai B (nos dois sentidos quando simétrico)
+   auto emB = [&](int a, int b) { return (sucB[a]==b)||((simetrico)&&(antB[a]==b)); };
+   auto dosPais = [&](int a, int b)
+   {
+      return (sucA[a]==b)||(emB(a, b))||((simetrico)&&(antA[a]==b));
+   };
+
+   //Um corte qualquer para começar a percorrer o pai A
+   int inicio = -1;
+   for (int id=0; (id<n)&&(inicio==-1); id++)
+      if (!emB(antA[id], id)) inicio = id;
+
+   if ((n<4)||(inicio==-1))
+   {
+      filhos.push_back(clona(parceiro1));
+      filhos.push_back(clona(parceiro2));
+      return filhos;
+   }
+
+   //Fragmentos, na ordem do pai A
+   vector<int> seq (n);
+   vector<int> frag (n);
+   vector<int> cabeca, cauda;
+   for (int p=0, id=inicio; p<n; p++, id=sucA[id])
+   {
+      seq[p] = id;
+      if ((p==0)||(!emB(antA[id], id)))
+      {
+         cabeca.push_back(id);
+         cauda.push_back(id);
+      }
+      cauda.back() = id;
+      frag[id] = cabeca.size()-1;
+   }
+
+   int qtdeFrag = cabeca.size();
+   int k = candidatos(parceiro1)->get_k();
+   auto dist = [&](int a, int b)
+   {
+      return VP_Mapa->get_distancia(parceiro1->get_por_id(a)->ori, parceiro1->get_por_id(b)->dest);
+   };
+
+   for (int f=0; f<2; f++)
+   {
+      //Fragmentos ainda não usados, removidos em O(1)
+      vector<int> livres (qtdeFrag), posLivre (qtdeFrag);
+      vector<char> usado (qtdeFrag, 0);
+      for (int i=0; i<qtdeFrag; i++) livres[i] = posLivre[i] = i;
+      auto usa = [&](int g)
+      {
+         usado[g] = 1;
+         int ultimo = livres.back();
+         livres[posLivre[g]] = ultimo;
+         posLivre[ultimo] = posLivre[g];
+         livres.pop_back();
+      };
+
+      vector<int> ids;
+      ids.reserve(n);
+
+      //Distância parcial e soma das menores saídas dos genes que faltam
+      double parcial = 0;
+      double restante = VP_somaMinSaida;
+      auto poe = [&](int id)
+      {
+         if (VP_limite>0)
+         {
+            if (!ids.empty()) parcial += dist(ids.back(), id);
+            restante -= VP_minSaida[id];
+         }
+         ids.push_back(id);
+      };
+
+      //Acrescenta o fragmento g entrando pela ponta v
+      auto acrescenta = [&](int g, int v)
+      {
+         if (v==cabeca[g])
+            for (int id=v; ; id=sucA[id]) { poe(id); if (id==cauda[g]) break; }
+         else
+            for (int id=v; ; id=antA[id]) { poe(id); if (id==cabeca[g]) break; }
+         usa(g);
+      };
+
+      int g = TUtils::rnd(0, qtdeFrag-1);
+      acrescenta(g, ((simetrico)&&(TUtils::rnd(0, 1)))?cauda[g]:cabeca[g]);
+
+      bool abortou = false;
+      while (!livres.empty())
+      {
+         if (excede(parcial, restante, ids.back()))
+         {
+            abortou = true;
+            break;
+         }
+
+         int fim = ids.back();
+         int prox = -1;
+
+         //Primeiro candidato que seja ponta de um fragmento livre
+         int *viz = VP_Candidatos->vizinhos(fim);
+         for (int j=0; (j<k)&&(prox==-1); j++)
+         {
+            int v = viz[j];
+            int h = frag[v];
+            if (usado[h]) continue;
+            if ((v!=cabeca[h])&&((!simetrico)||(v!=cauda[h]))) continue;
+            if (!dosPais(fim, v)) prox = v;
+         }
+
+         //Sem candidato, a ponta mais próxima entre todos os livres,
+         //aceitando uma aresta dos pais apenas se não houver outra
+         if (prox==-1)
+         {
+            double melhor = 0;
+            bool melhorDosPais = true;
+            for (int h : livres)
+            {
+               for (int lado=0; lado<(simetrico?2:1); lado++)
+               {
+                  int v = lado?cauda[h]:cabeca[h];
+                  bool pais = dosPais(fim, v);
+                  double d = dist(fim, v);
+                  if ((prox==-1)||((melhorDosPais)&&(!pais))||((pais==melhorDosPais)&&(d<melhor)))
+                  {
+                     prox = v;
+                     melhor = d;
+                     melhorDosPais = pais;
+                  }
+               }
+            }
+         }
+
+         acrescenta(frag[prox], prox);
+      }
+      if (abortou) continue;
+
+      //O gene 0 fica no início
+      rotate(ids.begin(), find(ids.begin(), ids.end(), 0), ids.end());
+
+      filhos.push_back(monta(parceiro1, parceiro2, ids));
+   }
+
+   return filhos;
+}
+
+/**
+ *
+ * Edge Recombination Crossover (ER)
+ *
+ * Whitley, Starkweather & Fuquay (1989). Scheduling Problems and Travelling
+ * Salesman: The Genetic Edge Recombination Operator. In Schaffer, J. (ed.)
+ * Proceedings on the Third International Conference on Genetic Algorithms,
+ * 133–140. Los Altos, CA: Morgan Kaufmann Publishers.
+ *
+ * A tabela com a união das arestas dos pais tem 4 posições por gene.
+ * O próximo gene é o vizinho com menos arestas restantes, desempatando
+ * pela distância; sem vizinhos, é sorteado um gene ainda livre. Cada
+ * filho é montado em O(n).
+ *
+ **/
+vector <TIndividuo *>TCruzamento::ER(TIndividuo *parceiro1, TIndividuo *parceiro2)
+{
+   vector <TIndividuo *> filhos;
+   int n = parceiro1->get_qtdeGenes();
+
+   vector<int> tabelaPais (4*n);
+   vector<int> grauPais (n, 0);
+   for (int id=0; id<n; id++)
+   {
+      TGene *a = parceiro1->get_por_id(id);
+      TGene *b = parceiro2->get_por_id(id);
+      int viz[4] = {a->ant->id, a->prox->id, b->ant->id, b->prox->id};
+
+      int *t = &tabelaPais[4*id];
+      for (int j=0; j<4; j++)
+         if ((viz[j]!=id)&&(find(t, t+grauPais[id], viz[j])==t+grauPais[id])) t[grauPais[id]++] = viz[j];
+   }
+
+   vector<int> tabela, grau;
+   vector<int> livres (n), posLivre (n);
+   vector<int> ids (n);
+
+   auto dist = [&](int a, int b)
+   {
+      return VP_Mapa->get_distancia(parceiro1->get_por_id(a)->ori, parceiro1->get_por_id(b)->dest);
+   };
+
+   bool poda = VP_limite>0;
+   if (poda) candidatos(parceiro1);
+
+   for (int f=0; f<2; f++)
+   {
+      tabela = tabelaPais;
+      grau = grauPais;
+      livres.resize(n);
+      for (int id=0; id<n; id++) livres[id] = posLivre[id] = id;
+
+      //Distância parcial e soma das menores saídas dos genes que faltam
+      double parcial = 0;
+      double restante = VP_somaMinSaida;
+      bool abortou = false;
+
+      int atual = TUtils::rnd(0, n-1);
+      for (int p=0; p<n; p++)
+      {
+         ids[p] = atual;
+
+         if (poda)
          {
-				j = 1;
-				fin_j = uFin;
+            if (p>0) parcial += dist(ids[p-1], atual);
+            restante -= VP_minSaida[atual];
+            if (excede(parcial, restante, atual))
+            {
+               abortou = true;
+               break;
+            }
          }
-			
-			it2 = parceiro2->get_por_indice(j);
-			it1 = filho1->get_por_id(it2->id);
-			if(it1->i<uInicio || it1->i>uFin) //Não está entre uInicio e uFin
+
+         //Retira o gene da lista de livres e das listas dos seus vizinhos
+         int ultimo = livres.back();
+         livres[posLivre[atual]] = ultimo;
+         posLivre[ultimo] = posLivre[atual];
+         livres.pop_back();
+
+         int *t = &tabela[4*atual];
+         for (int j=0; j<grau[atual]; j++)
          {
-				filho1->troca_indice(i, it1->i);
-				break;
+            int *tv = &tabela[4*t[j]];
+            int k = find(tv, tv+grau[t[j]], atual) - tv;
+            tv[k] = tv[--grau[t[j]]];
          }
-		}
 
-      if(i >= filho1->get_qtdeGenes()-1)
+         if (livres.empty()) break;
+
+         int prox = -1;
+         for (int j=0; j<grau[atual]; j++)
+            if ((prox==-1)||(grau[t[j]]<grau[prox])||
+                ((grau[t[j]]==grau[prox])&&(dist(atual, t[j])<dist(atual, prox))))
+               prox = t[j];
+
+         if (prox==-1) prox = livres[TUtils::rnd(0, livres.size()-1)];
+         atual = prox;
+      }
+      if (abortou) continue;
+
+      //O gene 0 fica no início
+      rotate(ids.begin(), find(ids.begin(), ids.end(), 0), ids.end());
+
+      filhos.push_back(monta(parceiro1, parceiro2, ids));
+   }
+
+   return filhos;
+}
+
+/**
+ *
+ * Inver-over (IO)
+ *
+ * Tao & Michalewicz (1998). Inver-over Operator for the TSP. In Eiben,
+ * Bäck, Schoenauer & Schwefel (eds.) Parallel Problem Solving from
+ * Nature V, 803–812. Springer.
+ *
+ * Cada pai é modificado apenas por inversões: a partir de um gene c, o
+ * gene c' é o sucessor de c em um guia sorteado da população (ou, com
+ * chance probAleatorioIO, um gene qualquer) e o caminho após c até c'
+ * é invertido, tornando c' vizinho de c. O processo para quando c' já
+ * é vizinho de c. O filho só substitui o pai quando não é pior.
+ *
+ **/
+vector <TIndividuo *>TCruzamento::InverOver(TIndividuo *parceiro1, TIndividuo *parceiro2)
+{
+   int n = parceiro1->get_qtdeGenes();
+
+   //A inversão no lado mais curto da rota exige custos simétricos
+   if ((n<4)||(!parceiro1->simetrico())||(!parceiro2->simetrico()))
+      return GSTX(parceiro1, parceiro2);
+
+   vector <TIndividuo *> filhos;
+   TIndividuo *pais[2] = {parceiro1, parceiro2};
+   TRota rota (VP_Mapa);
+
+   for (int f=0; f<2; f++)
+   {
+      TIndividuo *pai = pais[f];
+      rota.carrega(pai);
+
+      double delta = 0;
+      double melhorDelta = 0;
+      int c = TUtils::rnd(0, n-1);
+
+      //Inversões feitas depois da melhor rota vista, para desfazer
+      vector<int> desfaz;
+
+      for (int it=0; it<n; it++)
       {
-          i = 0;
-          fin_i = uInicio;
+         int c2;
+         if (TUtils::rndDouble()<probAleatorioIO)
+         {
+            c2 = TUtils::rnd(0, n-2);
+            if (c2>=c) c2++;
+         }
+         else
+         {
+            TIndividuo *guia = pais[1-f];
+            if ((VP_Populacao)&&(VP_Populacao->get_qtdeIndividuo()>1))
+               guia = VP_Populacao->get_individuo(TUtils::rnd(0, VP_Populacao->get_qtdeIndividuo()-1));
+            c2 = guia->get_por_id(c)->prox->id;
+         }
+
+         if ((rota.prox(c)==c2)||(rota.ant(c)==c2)) break;
+
+         int pc = rota.prox(c);
+         int pc2 = rota.prox(c2);
+         delta += rota.dist(c, c2) + rota.dist(pc, pc2) - rota.dist(c, pc) - rota.dist(c2, pc2);
+         rota.inverte(pc, c2);
+
+         desfaz.push_back(c);
+         desfaz.push_back(c2);
+         desfaz.push_back(pc);
+         if (delta<=melhorDelta)
+         {
+            melhorDelta = delta;
+            desfaz.clear();
+         }
+
+         c = c2;
       }
-	}
 
-	//Filho2
-	j = uFin;
-	fin_i = filho2->get_qtdeGenes();
-	fin_j = filho1->get_qtdeGenes();
-	for(int i = uFin+1; i < fin_i; i++)
-	{
-		while(j < fin_j)
-		{
-			j++;
-         if(j >= parceiro1->get_qtdeGenes())
+      TIndividuo *filho = clona(pai);
+      if (melhorDelta<0)
+      {
+         //Volta para a melhor rota vista ao longo das inversões. Depois de
+         //cada inversão c é vizinho de c2 e o caminho de c2 até pc é o invertido
+         for (int k=desfaz.size()-3; k>=0; k-=3)
          {
-				j = 1;
-				fin_j = uFin;
+            int a = desfaz[k], b = desfaz[k+1], d = desfaz[k+2];
+            if (rota.prox(a)==b) rota.inverte(b, d);
+            else rota.inverte(d, b);
          }
-			
-			it1 = parceiro1->get_por_indice(j);
-			it2 = filho2->get_por_id(it1->id);
-			if(it2->i<uInicio || it2->i>uFin) //Não está entre uInicio e uFin
+
+         rota.descarrega(filho);
+         filho->herdaNaoOlhar(pai);
+      }
+      filhos.push_back(filho);
+   }
+
+   return filhos;
+}
+
+/**
+ *
+ * Generalized Partition Crossover (GPX)
+ *
+ * Whitley, Hains & Howe (2009). Tunneling Between Optima: Partition
+ * Crossover for the Traveling Salesman Problem. Proceedings of the 11th
+ * Annual Conference on Genetic and Evolutionary Computation, 915–922.
+ *
+ * Retiradas as arestas comuns, a união dos pais se divide em componentes.
+ * Um componente em que o pai A entra uma única vez é ligado ao restante
+ * por apenas 2 arestas comuns, que o pai B também usa, e os dois pais
+ * passam por ele em caminhos com os mesmos genes e as mesmas pontas.
+ * Nesses componentes o filho fica com o caminho mais curto; nos demais,
+ * com o do pai base. O primeiro filho parte do melhor pai e o segundo
+ * do outro, de modo que nenhum é pior que o seu pai base. Tudo em O(n).
+ *
+ **/
+vector <TIndividuo *>TCruzamento::GPX(TIndividuo *parceiro1, TIndividuo *parceiro2)
+{
+   int n = parceiro1->get_qtdeGenes();
+
+   //A troca de caminhos entre os pais ignora o sentido das arestas
+   if ((n<4)||(!parceiro1->simetrico())||(!parceiro2->simetrico()))
+      return GSTX(parceiro1, parceiro2);
+
+   vector <TIndividuo *> filhos;
+   TIndividuo *pais[2] = {parceiro1, parceiro2};
+   if (parceiro2->get_distancia()<parceiro1->get_distancia()) swap(pais[0], pais[1]);
+
+   vector<int> viz[2] = {vector<int>(2*n), vector<int>(2*n)};
+   for (int p=0; p<2; p++)
+      for (int id=0; id<n; id++)
+      {
+         viz[p][2*id]   = pais[p]->get_por_id(id)->ant->id;
+         viz[p][2*id+1] = pais[p]->get_por_id(id)->prox->id;
+      }
+
+   auto comum = [&](int p, int a, int s)
+   {
+      int b = viz[p][2*a+s];
+      return (viz[1-p][2*a]==b)||(viz[1-p][2*a+1]==b);
+   };
+   auto dist = [&](int a, int b)
+   {
+      return VP_Mapa->get_distancia(pais[0]->get_por_id(a)->ori, pais[0]->get_por_id(b)->dest);
+   };
+
+   //Componentes ligados pelas arestas que só um dos pais tem
+   vector<int> comp (n, -1);
+   vector<int> pilha;
+   int qtdeComp = 0;
+   for (int v=0; v<n; v++)
+   {
+      if (comp[v]!=-1) continue;
+      if ((comum(0, v, 0))&&(comum(0, v, 1))) continue;
+
+      comp[v] = qtdeComp;
+      pilha.push_back(v);
+      while (!pilha.empty())
+      {
+         int a = pilha.back();
+         pilha.pop_back();
+         for (int p=0; p<2; p++)
+            for (int s=0; s<2; s++)
+            {
+               int b = viz[p][2*a+s];
+               if ((comp[b]==-1)&&(!comum(p, a, s)))
+               {
+                  comp[b] = qtdeComp;
+                  pilha.push_back(b);
+               }
+            }
+      }
+      qtdeComp++;
+   }
+
+   if (!qtdeComp)
+   {
+      filhos.push_back(clona(parceiro1));
+      filhos.push_back(clona(parceiro2));
+      return filhos;
+   }
+
+   //Entradas do pai A em cada componente e custo do caminho de cada pai
+   //dentro dele (as arestas comuns internas se cancelam)
+   vector<int> entradas (qtdeComp, 0);
+   vector<double> custo[2] = {vector<double>(qtdeComp, 0), vector<double>(qtdeComp, 0)};
+
+   TGene *g = pais[0]->get_por_indice(0);
+   for (int i=0; i<n; i++, g=g->prox)
+      if ((comp[g->id]!=-1)&&(comp[g->ant->id]!=comp[g->id])) entradas[comp[g->id]]++;
+
+   for (int p=0; p<2; p++)
+      for (int a=0; a<n; a++)
+         if ((comp[a]!=-1)&&(!comum(p, a, 1))) custo[p][comp[a]] += dist(a, viz[p][2*a+1]);
+
+   vector<int> ids (n);
+   for (int f=0; f<2; f++)
+   {
+      //Parte do pai base e troca os componentes viáveis mais curtos no outro
+      vector<int> filho = viz[f];
+      for (int a=0; a<n; a++)
+      {
+         int c = comp[a];
+         if ((c!=-1)&&(entradas[c]<=1)&&(custo[1-f][c]<custo[f][c]))
          {
-				filho2->troca_indice(i, it2->i);
-				break;
+            filho[2*a]   = viz[1-f][2*a];
+            filho[2*a+1] = viz[1-f][2*a+1];
          }
-		}
+      }
 
-      if(i >= filho2->get_qtdeGenes()-1)
+      ids[0] = 0;
+      for (int p=1, ant=0, atual=filho[1]; p<n; p++)
       {
-          i = 0;
-          fin_i = uInicio;
+         ids[p] = atual;
+         int prox = (filho[2*atual]!=ant)?filho[2*atual]:filho[2*atual+1];
+         ant = atual;
+         atual = prox;
       }
-	}
-	
-   filhos.push_back(filho1);
-   filhos.push_back(filho2);
-	
-	return filhos;
+
+      filhos.push_back(monta(parceiro1, parceiro2, ids));
+   }
+
+   return filhos;
+}
+
+//Coloca os genes do filho na ordem de ids, calculando a distância
+//em uma única passada, e mantém os don't look bits dos pais
+TIndividuo *TCruzamento::monta (TIndividuo *parceiro1, TIndividuo *parceiro2, vector<int> &ids)
+{
+   TIndividuo *filho = criaFilho(parceiro1);
+   filho->reordena(ids);
+   filho->herdaNaoOlhar(parceiro1);
+   filho->herdaNaoOlhar(parceiro2);
+   return filho;
+}
+
+TIndividuo *TCruzamento::criaFilho (TIndividuo *modelo)
+{
+   if (VP_Destino) return VP_Destino->reserva(modelo);
+
+   TIndividuo *filho = new TIndividuo(VP_Mapa, VP_ArqSaida);
+   filho->copia(modelo);
+   return filho;
+}
+
+TIndividuo *TCruzamento::clona (TIndividuo *individuo)
+{
+   TIndividuo *clone = criaFilho(individuo);
+   clone->copia(individuo);
+   return clone;
+}
+
+TListaCandidatos *TCruzamento::candidatos (TIndividuo *individuo)
+{
+   if (!VP_Candidatos) VP_Candidatos = new TListaCandidatos(VP_Mapa);
+
+   if (!VP_Candidatos->mesmosGenes(individuo))
+   {
+      VP_Candidatos->monta(individuo, VP_numCandidatos);
+
+      //O primeiro candidato é a menor saída de cada gene
+      int n = individuo->get_qtdeGenes();
+      VP_minSaida.assign(n, 0);
+      VP_somaMinSaida = 0;
+      for (int id=0; (id<n)&&(n>1); id++)
+      {
+         int v = VP_Candidatos->vizinhos(id)[0];
+         VP_minSaida[id] = VP_Mapa->get_distancia(individuo->get_por_id(id)->ori, individuo->get_por_id(v)->dest);
+         VP_somaMinSaida += VP_minSaida[id];
+      }
+   }
+
+   return VP_Candidatos;
+}
+
+bool TCruzamento::excede (double parcial, double restante, int ultimo)
+{
+   return (VP_limite>0)&&(parcial+restante+VP_minSaida[ultimo]>=VP_limite);
 }
 
 /**
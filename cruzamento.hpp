@@ -17,6 +17,14 @@
 #include "utils.hpp"
 #include "tsp.hpp"
 #include "arqlog.hpp"
+#include "candidatos.hpp"
+#include "eax.hpp"
+#include "populacao.hpp"
+#include "rota.hpp"
+
+//Chance do inver-over escolher o próximo gene ao acaso em vez
+//de seguir o indivíduo guia
+const double probAleatorioIO = 0.02;
 
 class TCruzamento
 {
@@ -25,6 +33,25 @@ class TCruzamento
       TArqLog *VP_ArqSaida;
 
       int VP_cruzamento;
+      int VP_numCandidatos;
+      int VP_estrategiaEAX;
+      int VP_filhosEAX;
+
+      //Lista de vizinhos usada pelo EAX para juntar as sub-rotas,
+      //refeita apenas quando o conjunto de genes muda
+      TListaCandidatos *VP_Candidatos;
+
+      //População de onde o inver-over sorteia os guias
+      TPopulacao *VP_Populacao;
+      //População que recebe os filhos, de cuja reserva eles são tirados
+      TPopulacao *VP_Destino;
+
+      //Distância que o filho precisa superar (0 = sem limite). Os
+      //cruzamentos construtivos abortam o filho quando a distância
+      //parcial mais a menor saída de cada gene em aberto não fica abaixo
+      double VP_limite;
+      vector<double> VP_minSaida;
+      double VP_somaMinSaida;
    public:
 
       //Apenas leitura
@@ -33,12 +60,39 @@ class TCruzamento
 
 
       TCruzamento (TMapaGenes *mapa, TArqLog *arqSaida, int tipoCruzamento);
+      ~TCruzamento ();
       vector <TIndividuo *>processa (TIndividuo *parceiro1, TIndividuo *parceiro2);
 
+      void setNumCandidatos (int val);
+      int getNumCandidatos ();
+      void setEstrategiaEAX (int val);
+      int getEstrategiaEAX ();
+      void setFilhosEAX (int val);
+      int getFilhosEAX ();
+      void setPopulacao (TPopulacao *populacao);
+      void setDestino (TPopulacao *destino);
+      void setLimite (double val);
+      double getLimite ();
+
    private:
       vector <TIndividuo *>GSTX (TIndividuo *parceiro1, TIndividuo *parceiro2);
       vector <TIndividuo *>PMX(TIndividuo *parceiro1, TIndividuo *parceiro2);
 		vector <TIndividuo *>OX1(TIndividuo *parceiro1, TIndividuo *parceiro2);
+      vector <TIndividuo *>EAX(TIndividuo *parceiro1, TIndividuo *parceiro2);
+      vector <TIndividuo *>DPX(TIndividuo *parceiro1, TIndividuo *parceiro2);
+      vector <TIndividuo *>ER(TIndividuo *parceiro1, TIndividuo *parceiro2);
+      vector <TIndividuo *>InverOver(TIndividuo *parceiro1, TIndividuo *parceiro2);
+      vector <TIndividuo *>GPX(TIndividuo *parceiro1, TIndividuo *parceiro2);
+
+      //Métodos auxiliares
+      TListaCandidatos *candidatos (TIndividuo *individuo);
+      TIndividuo *monta (TIndividuo *parceiro1, TIndividuo *parceiro2, vector<int> &ids);
+      //Filho com os genes do modelo em qualquer ordem, tirado da reserva do destino
+      TIndividuo *criaFilho (TIndividuo *modelo);
+      TIndividuo *clona (TIndividuo *individuo);
+      //Se o filho com a distância parcial dada, os genes em aberto somando
+      //restante de menor saída e o último gene em ultimo não supera o limite
+      bool excede (double parcial, double restante, int ultimo);
 
 };
 #endif
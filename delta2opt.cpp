@@ -0,0 +1,176 @@
+/*
+*  delta2opt.cpp
+*
+*  Módulo responsável pelo cálculo vetorizado (AVX2 / AVX-512) da
+*  variação do 2-opt. A versão é escolhida em tempo de execução
+*  conforme o processador, com uma versão escalar para os demais
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#include "delta2opt.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+   #define DELTA2OPT_X86
+   #include <immintrin.h>
+#endif
+
+int TDelta2opt::melhorJ (const double *linhaA, const double *linhaB, const int *c,
+                         const double *e, double base, int jIni, int jFim, double &melhor)
+{
+#ifdef DELTA2OPT_X86
+   //Verificado uma única vez: 2 = AVX-512, 1 = AVX2, 0 = escalar
+   static int versao = __builtin_cpu_supports("avx512f")?2:(__builtin_cpu_supports("avx2")?1:0);
+
+   if (versao==2) return avx512(linhaA, linhaB, c, e, base, jIni, jFim, melhor);
+   if (versao==1) return avx2(linhaA, linhaB, c, e, base, jIni, jFim, melhor);
+#endif
+   return escalar(linhaA, linhaB, c, e, base, jIni, jFim, melhor);
+}
+
+int TDelta2opt::escalar (const double *linhaA, const double *linhaB, const int *c,
+                         const double *e, double base, int jIni, int jFim, double &melhor)
+{
+   int escolha = -1;
+
+   for (int j=jIni; j<jFim; j++)
+   {
+      double delta = linhaA[c[j]] + linhaB[c[j+1]] - e[j] - base;
+      if (delta<melhor)
+      {
+         melhor = delta;
+         escolha = j;
+      }
+   }
+   return escolha;
+}
+
+#ifdef DELTA2OPT_X86
+
+//Cada posição do vetor guarda o seu menor valor e o j correspondente
+//(como double, exato). Em empates fica o primeiro j de cada posição e,
+//ao juntar as posições, o menor j, igual à varredura escalar.
+__attribute__((target("avx2")))
+int TDelta2opt::avx2 (const double *linhaA, const double *linhaB, const int *c,
+                      const double *e, double base, int jIni, int jFim, double &melhor)
+{
+   int j = jIni;
+   int escolha = -1;
+
+   if (jFim-jIni>=4)
+   {
+      __m256d vMelhor = _mm256_set1_pd(melhor);
+      __m256d vEscolha = _mm256_set1_pd(-1);
+      __m256d vJ = _mm256_setr_pd(j, j+1, j+2, j+3);
+      __m256d vQuatro = _mm256_set1_pd(4);
+      __m256d vBase = _mm256_set1_pd(base);
+      //Gather com máscara e origem zerada explícitas, a forma sem máscara
+      //deixa a origem indefinida
+      __m256d vZero = _mm256_setzero_pd();
+      __m256d vTodos = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+      for (; j+4<=jFim; j+=4)
+      {
+         __m128i cj  = _mm_loadu_si128((const __m128i *)(c+j));
+         __m128i cj1 = _mm_loadu_si128((const __m128i *)(c+j+1));
+
+         __m256d delta = _mm256_add_pd(_mm256_mask_i32gather_pd(vZero, linhaA, cj, vTodos, 8),
+                                       _mm256_mask_i32gather_pd(vZero, linhaB, cj1, vTodos, 8));
+         delta = _mm256_sub_pd(delta, _mm256_loadu_pd(e+j));
+         delta = _mm256_sub_pd(delta, vBase);
+
+         __m256d menor = _mm256_cmp_pd(delta, vMelhor, _CMP_LT_OQ);
+         vMelhor = _mm256_blendv_pd(vMelhor, delta, menor);
+         vEscolha = _mm256_blendv_pd(vEscolha, vJ, menor);
+         vJ = _mm256_add_pd(vJ, vQuatro);
+      }
+
+      double m[4], esc[4];
+      _mm256_storeu_pd(m, vMelhor);
+      _mm256_storeu_pd(esc, vEscolha);
+      for (int l=0; l<4; l++)
+      {
+         if (esc[l]<0) continue;
+         if ((m[l]<melhor)||((m[l]==melhor)&&(escolha>=0)&&((int)esc[l]<escolha)))
+         {
+            melhor = m[l];
+            escolha = (int)esc[l];
+         }
+      }
+   }
+
+   //Posições que sobraram
+   int resto = escalar(linhaA, linhaB, c, e, base, j, jFim, melhor);
+   return (resto>=0)?resto:escolha;
+}
+
+__attribute__((target("avx512f")))
+int TDelta2opt::avx512 (const double *linhaA, const double *linhaB, const int *c,
+                        const double *e, double base, int jIni, int jFim, double &melhor)
+{
+   int j = jIni;
+   int escolha = -1;
+
+   if (jFim-jIni>=8)
+   {
+      __m512d vMelhor = _mm512_set1_pd(melhor);
+      __m512d vEscolha = _mm512_set1_pd(-1);
+      __m512d vJ = _mm512_setr_pd(j, j+1, j+2, j+3, j+4, j+5, j+6, j+7);
+      __m512d vOito = _mm512_set1_pd(8);
+      __m512d vBase = _mm512_set1_pd(base);
+      __m512d vZero = _mm512_setzero_pd();
+
+      for (; j+8<=jFim; j+=8)
+      {
+         __m256i cj  = _mm256_loadu_si256((const __m256i *)(c+j));
+         __m256i cj1 = _mm256_loadu_si256((const __m256i *)(c+j+1));
+
+         __m512d delta = _mm512_add_pd(_mm512_mask_i32gather_pd(vZero, 0xFF, cj, linhaA, 8),
+                                       _mm512_mask_i32gather_pd(vZero, 0xFF, cj1, linhaB, 8));
+         delta = _mm512_sub_pd(delta, _mm512_loadu_pd(e+j));
+         delta = _mm512_sub_pd(delta, vBase);
+
+         __mmask8 menor = _mm512_cmp_pd_mask(delta, vMelhor, _CMP_LT_OQ);
+         vMelhor = _mm512_mask_blend_pd(menor, vMelhor, delta);
+         vEscolha = _mm512_mask_blend_pd(menor, vEscolha, vJ);
+         vJ = _mm512_add_pd(vJ, vOito);
+      }
+
+      double m[8], esc[8];
+      _mm512_storeu_pd(m, vMelhor);
+      _mm512_storeu_pd(esc, vEscolha);
+      for (int l=0; l<8; l++)
+      {
+         if (esc[l]<0) continue;
+         if ((m[l]<melhor)||((m[l]==melhor)&&(escolha>=0)&&((int)esc[l]<escolha)))
+         {
+            melhor = m[l];
+            escolha = (int)esc[l];
+         }
+      }
+   }
+
+   //Posições que sobraram
+   int resto = escalar(linhaA, linhaB, c, e, base, j, jFim, melhor);
+   return (resto>=0)?resto:escolha;
+}
+
+#else
+
+int TDelta2opt::avx2 (const double *linhaA, const double *linhaB, const int *c,
+                      const double *e, double base, int jIni, int jFim, double &melhor)
+{
+   return escalar(linhaA, linhaB, c, e, base, jIni, jFim, melhor);
+}
+
+int TDelta2opt::avx512 (const double *linhaA, const double *linhaB, const int *c,
+                        const double *e, double base, int jIni, int jFim, double &melhor)
+{
+   return escalar(linhaA, linhaB, c, e, base, jIni, jFim, melhor);
+}
+
+#endif
@@ -0,0 +1,42 @@
+/*
+*  delta2opt.hpp
+*
+*  Módulo responsável pelo cálculo vetorizado (AVX2 / AVX-512) da
+*  variação do 2-opt. A versão é escolhida em tempo de execução
+*  conforme o processador, com uma versão escalar para os demais
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#ifndef _DELTA2OPT_H
+#define	_DELTA2OPT_H
+
+/*************************************************************
+Para um i fixo, a variação de inverter as posições i..j é
+   linhaA[c[j]] + linhaB[c[j+1]] - e[j] - base
+onde linhaA e linhaB são as linhas da matriz das cidades nas
+posições i-1 e i, c[] as cidades da rota e e[j] o custo da
+aresta (j, j+1). Só vale para indivíduos simétricos.
+*************************************************************/
+class TDelta2opt
+{
+   public:
+      //Menor variação para j em [jIni, jFim). Retorna o menor j com
+      //variação estritamente menor que "melhor" (atualizado) ou -1
+      static int melhorJ (const double *linhaA, const double *linhaB, const int *c,
+                          const double *e, double base, int jIni, int jFim, double &melhor);
+
+   private:
+      static int escalar (const double *linhaA, const double *linhaB, const int *c,
+                          const double *e, double base, int jIni, int jFim, double &melhor);
+      static int avx2 (const double *linhaA, const double *linhaB, const int *c,
+                       const double *e, double base, int jIni, int jFim, double &melhor);
+      static int avx512 (const double *linhaA, const double *linhaB, const int *c,
+                         const double *e, double base, int jIni, int jFim, double &melhor);
+};
+
+#endif
@@ -0,0 +1,366 @@
+/*
+*  eax.cpp
+*
+*  Módulo responsável pelo Edge Assembly Crossover (EAX), utilizado
+*  pelo cruzamento quando o indivíduo é simétrico
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#include "eax.hpp"
+
+TEAX::TEAX (TMapaGenes *mapa, TListaCandidatos *candidatos)
+{
+   VP_Mapa = mapa;
+   VP_Candidatos = candidatos;
+   VP_n = 0;
+}
+
+/**
+ *
+ * Edge Assembly Crossover (EAX)
+ *
+ * Nagata & Kobayashi (1997). Edge Assembly Crossover: A High-power
+ * Genetic Algorithm for the Traveling Salesman Problem. Proceedings of
+ * the 7th International Conference on Genetic Algorithms, 450–457.
+ *
+ * Nagata & Kobayashi (2013). A Powerful Genetic Algorithm Using Edge
+ * Assembly Crossover for the Traveling Salesman Problem. INFORMS Journal
+ * on Computing, 25(2), 346–363.
+ *
+ * As arestas de um só dos pais formam ciclos que alternam arestas de A e
+ * de B (ciclos AB). Cada filho parte de A, troca as arestas de A pelas de
+ * B nos ciclos escolhidos e junta as sub-rotas resultantes com o menor
+ * 2-opt entre os vizinhos candidatos. Cada filho custa O(n).
+ *
+ **/
+void TEAX::processa (TIndividuo *pai1, TIndividuo *pai2, int estrategia, int qtdeFilhos, vector<int> &ids)
+{
+   carrega(pai1, pai2);
+   extraiCiclos();
+
+   ids.resize(VP_n);
+   if (VP_ciclos.empty())
+   {
+      for (int k=0; k<VP_n; k++) ids[k] = pai1->get_por_indice(k)->id;
+      return;
+   }
+
+   //Centros dos filhos, sem repetição
+   vector<int> ordem (VP_ciclos.size());
+   for (unsigned c=0; c<ordem.size(); c++) ordem[c] = c;
+   for (int c=ordem.size()-1; c>0; c--) swap(ordem[c], ordem[TUtils::rnd(0, c)]);
+   if (qtdeFilhos>(int)ordem.size()) qtdeFilhos = ordem.size();
+   if (qtdeFilhos<1) qtdeFilhos = 1;
+
+   vector<int> marca (VP_n, -1);
+   vector<int> eSet;
+   vector<int> atual (VP_n);
+   vector<int> melhorIds;
+   double melhor = 0;
+
+   for (int f=0; f<qtdeFilhos; f++)
+   {
+      eSet.clear();
+      eSet.push_back(ordem[f]);
+
+      if (estrategia==1)
+      {
+         for (int v : VP_ciclos[ordem[f]]) marca[v] = f;
+         for (unsigned c=0; c<VP_ciclos.size(); c++)
+         {
+            if ((int)c==ordem[f]) continue;
+            for (int v : VP_ciclos[c])
+               if (marca[v]==f)
+               {
+                  eSet.push_back(c);
+                  break;
+               }
+         }
+      }
+
+      montaIntermediario(eSet);
+      juntaSubrotas();
+
+      double custo = sequencia(atual);
+      if ((melhorIds.empty())||(custo<melhor))
+      {
+         melhor = custo;
+         melhorIds = atual;
+      }
+   }
+
+   ids = melhorIds;
+}
+
+void TEAX::carrega (TIndividuo *pai1, TIndividuo *pai2)
+{
+   VP_n = pai1->get_qtdeGenes();
+   VP_cidade.resize(VP_n);
+   VP_vizA.resize(2*VP_n);
+   VP_vizB.resize(2*VP_n);
+
+   for (int id=0; id<VP_n; id++)
+   {
+      TGene *a = pai1->get_por_id(id);
+      TGene *b = pai2->get_por_id(id);
+      VP_cidade[id] = a->ori;
+      VP_vizA[2*id]   = a->ant->id;
+      VP_vizA[2*id+1] = a->prox->id;
+      VP_vizB[2*id]   = b->ant->id;
+      VP_vizB[2*id+1] = b->prox->id;
+   }
+}
+
+//Caminhada alternando arestas de A e de B que não são comuns aos pais.
+//Quando a caminhada volta a um gene pela aresta do tipo oposto ao da
+//saída anterior, o trecho entre as duas passagens é um ciclo AB
+void TEAX::extraiCiclos ()
+{
+   int n = VP_n;
+   VP_ciclos.clear();
+
+   //Arestas restantes de cada gene, até 2 de cada pai
+   vector<int> adj[2] = {vector<int>(2*n), vector<int>(2*n)};
+   vector<int> qtde[2] = {vector<int>(n, 0), vector<int>(n, 0)};
+
+   for (int v=0; v<n; v++)
+   {
+      for (int s=0; s<2; s++)
+      {
+         int a = VP_vizA[2*v+s];
+         int b = VP_vizB[2*v+s];
+         if ((VP_vizB[2*v]!=a)&&(VP_vizB[2*v+1]!=a)) adj[0][2*v+qtde[0][v]++] = a;
+         if ((VP_vizA[2*v]!=b)&&(VP_vizA[2*v+1]!=b)) adj[1][2*v+qtde[1][v]++] = b;
+      }
+   }
+
+   //Última posição do gene no caminho, para cada paridade
+   vector<int> posPar (2*n, -1);
+   vector<int> caminho;
+   caminho.reserve(2*n+1);
+
+   vector<int> inicio (n);
+   for (int v=0; v<n; v++) inicio[v] = v;
+   for (int v=n-1; v>0; v--) swap(inicio[v], inicio[TUtils::rnd(0, v)]);
+
+   for (int v0 : inicio)
+   {
+      if (!qtde[0][v0]) continue;
+
+      caminho.clear();
+      caminho.push_back(v0);
+      posPar[2*v0] = 0;
+
+      while (true)
+      {
+         int q = caminho.size()-1;
+         int atual = caminho[q];
+         int tipo = q%2;
+
+         if (!qtde[tipo][atual])
+         {
+            posPar[2*atual] = -1;
+            break;
+         }
+
+         //Retira a aresta (atual, w) das duas pontas
+         int r = (qtde[tipo][atual]==2)?TUtils::rnd(0, 1):0;
+         int w = adj[tipo][2*atual+r];
+         adj[tipo][2*atual+r] = adj[tipo][2*atual+(--qtde[tipo][atual])];
+         for (int s=0; s<qtde[tipo][w]; s++)
+            if (adj[tipo][2*w+s]==atual)
+            {
+               adj[tipo][2*w+s] = adj[tipo][2*w+(--qtde[tipo][w])];
+               break;
+            }
+
+         caminho.push_back(w);
+         q++;
+
+         int p = posPar[2*w+(q%2)];
+         if (p==-1)
+         {
+            posPar[2*w+(q%2)] = q;
+            continue;
+         }
+
+         //Ciclo caminho[p..q-1], começando por uma aresta de A
+         vector<int> ciclo (caminho.begin()+p, caminho.begin()+q);
+         if (p%2) rotate(ciclo.begin(), ciclo.begin()+1, ciclo.end());
+         VP_ciclos.push_back(ciclo);
+
+         for (int t=p+1; t<q; t++) posPar[2*caminho[t]+(t%2)] = -1;
+         caminho.resize(p+1);
+      }
+   }
+}
+
+//Troca o vizinho de do gene a por para
+void TEAX::substitui (int a, int de, int para)
+{
+   if (VP_viz[2*a]==de) VP_viz[2*a] = para;
+   else VP_viz[2*a+1] = para;
+}
+
+//Parte de A, retira as arestas de A e inclui as de B dos ciclos escolhidos
+void TEAX::montaIntermediario (vector<int> &eSet)
+{
+   VP_viz = VP_vizA;
+
+   for (int c : eSet)
+   {
+      vector<int> &ciclo = VP_ciclos[c];
+      int tam = ciclo.size();
+      for (int i=0; i<tam; i+=2)
+      {
+         substitui(ciclo[i], ciclo[i+1], -1);
+         substitui(ciclo[i+1], ciclo[i], -1);
+      }
+   }
+
+   for (int c : eSet)
+   {
+      vector<int> &ciclo = VP_ciclos[c];
+      int tam = ciclo.size();
+      for (int i=1; i<tam; i+=2)
+      {
+         int a = ciclo[i];
+         int b = ciclo[(i+1)%tam];
+         substitui(a, -1, b);
+         substitui(b, -1, a);
+      }
+   }
+}
+
+//Enquanto houver mais de uma sub-rota, a menor é ligada a outra pela troca
+//de arestas (u,u2),(v,v2) por (u,v),(u2,v2) ou (u,v2),(u2,v) de menor
+//custo, com v entre os vizinhos candidatos de u
+void TEAX::juntaSubrotas ()
+{
+   int n = VP_n;
+   VP_comp.assign(n, -1);
+   VP_membros.clear();
+
+   for (int v=0; v<n; v++)
+   {
+      if (VP_comp[v]!=-1) continue;
+
+      int c = VP_membros.size();
+      VP_membros.push_back(vector<int>());
+      int ant = v;
+      int atual = v;
+      do
+      {
+         VP_comp[atual] = c;
+         VP_membros[c].push_back(atual);
+         int prox = (VP_viz[2*atual]!=ant)?VP_viz[2*atual]:VP_viz[2*atual+1];
+         if (atual==v) prox = VP_viz[2*v];
+         ant = atual;
+         atual = prox;
+      } while (atual!=v);
+   }
+
+   int qtdeComp = VP_membros.size();
+   int k = VP_Candidatos->get_k();
+
+   while (qtdeComp>1)
+   {
+      int U = -1;
+      for (unsigned c=0; c<VP_membros.size(); c++)
+         if ((!VP_membros[c].empty())&&((U==-1)||(VP_membros[c].size()<VP_membros[U].size()))) U = c;
+
+      double melhor = 0;
+      int mu = -1, mu2 = -1, mv = -1, mv2 = -1;
+      bool cruzado = false;
+
+      //Sem candidato fora da sub-rota, todos os genes são testados
+      for (int todos=0; (todos<2)&&(mu==-1); todos++)
+      {
+         for (int u : VP_membros[U])
+         {
+            int *viz = VP_Candidatos->vizinhos(u);
+            int qtde = todos?n:k;
+            for (int j=0; j<qtde; j++)
+            {
+               int v = todos?j:viz[j];
+               if (VP_comp[v]==U) continue;
+
+               for (int s=0; s<2; s++)
+               {
+                  int u2 = VP_viz[2*u+s];
+                  for (int t=0; t<2; t++)
+                  {
+                     int v2 = VP_viz[2*v+t];
+                     double base = dist(u, u2) + dist(v, v2);
+                     double g1 = dist(u, v) + dist(u2, v2) - base;
+                     double g2 = dist(u, v2) + dist(u2, v) - base;
+
+                     if ((mu==-1)||(g1<melhor))
+                     {
+                        melhor = g1;
+                        mu = u; mu2 = u2; mv = v; mv2 = v2;
+                        cruzado = false;
+                     }
+                     if (g2<melhor)
+                     {
+                        melhor = g2;
+                        mu = u; mu2 = u2; mv = v; mv2 = v2;
+                        cruzado = true;
+                     }
+                  }
+               }
+            }
+         }
+      }
+
+      if (!cruzado)
+      {
+         substitui(mu, mu2, mv);
+         substitui(mu2, mu, mv2);
+         substitui(mv, mv2, mu);
+         substitui(mv2, mv, mu2);
+      }
+      else
+      {
+         substitui(mu, mu2, mv2);
+         substitui(mu2, mu, mv);
+         substitui(mv, mv2, mu2);
+         substitui(mv2, mv, mu);
+      }
+
+      //A sub-rota menor passa para a do gene v
+      int destino = VP_comp[mv];
+      for (int u : VP_membros[U])
+      {
+         VP_comp[u] = destino;
+         VP_membros[destino].push_back(u);
+      }
+      VP_membros[U].clear();
+      qtdeComp--;
+   }
+}
+
+//Sequência de ids a partir do gene 0 e a distância da rota
+double TEAX::sequencia (vector<int> &ids)
+{
+   double custo = 0;
+   int ant = 0;
+   int atual = VP_viz[0];
+   ids[0] = 0;
+
+   for (int p=1; p<VP_n; p++)
+   {
+      ids[p] = atual;
+      custo += dist(ant, atual);
+      int prox = (VP_viz[2*atual]!=ant)?VP_viz[2*atual]:VP_viz[2*atual+1];
+      ant = atual;
+      atual = prox;
+   }
+
+   return custo + dist(ant, 0);
+}
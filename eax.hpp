@@ -0,0 +1,64 @@
+/*
+*  eax.hpp
+*
+*  Módulo responsável pelo Edge Assembly Crossover (EAX), utilizado
+*  pelo cruzamento quando o indivíduo é simétrico
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#ifndef _EAX_H
+#define	_EAX_H
+
+#include <vector>
+#include "individuo.hpp"
+#include "candidatos.hpp"
+#include "tsp.hpp"
+
+/*************************************************************
+As rotas são guardadas como os 2 vizinhos de cada gene (por id),
+em vetores de 2*n posições. Um vizinho -1 indica aresta retirada.
+*************************************************************/
+class TEAX
+{
+   private:
+      TMapaGenes *VP_Mapa;
+      TListaCandidatos *VP_Candidatos;
+
+      int VP_n;
+      vector<int> VP_cidade;
+      vector<int> VP_vizA;
+      vector<int> VP_vizB;
+
+      //Ciclos AB. A aresta (c[i], c[i+1]) é do pai A quando i é par
+      vector< vector<int> > VP_ciclos;
+
+      //Filho intermediário e suas sub-rotas
+      vector<int> VP_viz;
+      vector<int> VP_comp;
+      vector< vector<int> > VP_membros;
+
+      double dist (int a, int b) { return VP_Mapa->get_distancia(VP_cidade[a], VP_cidade[b]); }
+
+      void carrega (TIndividuo *pai1, TIndividuo *pai2);
+      void extraiCiclos ();
+      void montaIntermediario (vector<int> &eSet);
+      void juntaSubrotas ();
+      void substitui (int a, int de, int para);
+      double sequencia (vector<int> &ids);
+
+   public:
+      TEAX (TMapaGenes *mapa, TListaCandidatos *candidatos);
+
+      //Gera até qtdeFilhos filhos a partir do pai1 e devolve em ids a
+      //sequência do melhor (ids[0] = 0).
+      //estrategia: 0 = single (um ciclo AB), 1 = bloco (um ciclo AB e
+      //os que compartilham genes com ele)
+      void processa (TIndividuo *pai1, TIndividuo *pai2, int estrategia, int qtdeFilhos, vector<int> &ids);
+};
+
+#endif
@@ -0,0 +1,358 @@
+/*
+*  exato.cpp
+*
+*  Módulo responsável pelos métodos exatos, utilizados quando a
+*  quantidade de genes (reduzida pela recursividade) é pequena
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#include "exato.hpp"
+#include <cmath>
+
+TExato::TExato (TMapaGenes *mapa)
+{
+   VP_Mapa = mapa;
+}
+
+/**
+ *
+ * Programação dinâmica de Held-Karp, O(n^2 * 2^n)
+ *
+ * Held & Karp (1962). A Dynamic Programming Approach to Sequencing Problems.
+ * Journal of the Society for Industrial and Applied Mathematics, 10(1), 196–210.
+ *
+ * O gene 0 é fixo no início da rota, logo os estados são os subconjuntos
+ * dos genes 1..n-1. A tabela é de double: as arestas dos indivíduos
+ * reduzidos chegam à escala de infinito e, com float, somas dessa ordem
+ * perdem unidades e a escolha deixaria de ser exata.
+ *
+ **/
+int TExato::heldKarp (TIndividuo *individuo)
+{
+   int n = individuo->get_qtdeGenes();
+   if ((n<3)||(n>maxGenesPD)) return 0;
+
+   int m = n-1;
+   unsigned completo = (1u<<m)-1;
+
+   //Custos entre genes. c[a*n+b] é o custo de sair de a e chegar em b
+   vector<double> c (n*n);
+   for (int a=0; a<n; a++)
+      for (int b=0; b<n; b++)
+         c[a*n+b] = VP_Mapa->get_distancia(individuo->get_por_id(a)->ori, individuo->get_por_id(b)->dest);
+
+   //pd[S*m+j]: menor caminho saindo de 0, passando por S e terminando em j+1
+   vector<double> pd ((size_t)(completo+1)*m, INFINITY);
+
+   for (int j=0; j<m; j++) pd[(size_t)(1u<<j)*m+j] = c[j+1];
+
+   for (unsigned S=1; S<=completo; S++)
+   {
+      for (int j=0; j<m; j++)
+      {
+         if (!(S&(1u<<j))) continue;
+         unsigned ant = S^(1u<<j);
+         if (!ant) continue;
+
+         double melhor = INFINITY;
+         for (unsigned r=ant; r; r&=r-1)
+         {
+            int k = __builtin_ctz(r);
+            double v = pd[(size_t)ant*m+k] + c[(k+1)*n+j+1];
+            if (v<melhor) melhor = v;
+         }
+         pd[(size_t)S*m+j] = melhor;
+      }
+   }
+
+   //Fechando o ciclo
+   int ult = -1;
+   double melhor = INFINITY;
+   for (int j=0; j<m; j++)
+   {
+      double v = pd[(size_t)completo*m+j] + c[(j+1)*n];
+      if (v<melhor)
+      {
+         melhor = v;
+         ult = j;
+      }
+   }
+
+   //Reconstruindo a rota de trás para frente, refazendo a mesma conta
+   //da tabela. Assim não é necessário guardar a tabela de predecessores
+   vector<int> ids (n);
+   unsigned S = completo;
+   ids[0] = 0;
+   for (int p=m; p>=1; p--)
+   {
+      ids[p] = ult+1;
+      unsigned ant = S^(1u<<ult);
+      int escolha = -1;
+      double v_min = INFINITY;
+      for (unsigned r=ant; r; r&=r-1)
+      {
+         int k = __builtin_ctz(r);
+         double v = pd[(size_t)ant*m+k] + c[(k+1)*n+ult+1];
+         if (v<v_min)
+         {
+            v_min = v;
+            escolha = k;
+         }
+      }
+      S = ant;
+      ult = escolha;
+   }
+
+   double dist = 0;
+   for (int p=0; p<n; p++)
+      dist += VP_Mapa->get_distancia(individuo->get_por_id(ids[p])->ori, individuo->get_por_id(ids[(p+1)%n])->dest);
+
+   if (dist>=individuo->get_distancia()) return 0;
+
+   individuo->reordena(ids);
+   return 1;
+}
+
+/**
+ *
+ * Branch-and-bound em profundidade
+ *
+ * Little, Murty, Sweeney & Karel (1963). An Algorithm for the Traveling
+ * Salesman Problem. Operations Research, 11(6), 972–989.
+ *
+ * O limite inferior é o problema de designação (Hungarian) sobre o que
+ * falta da rota: o gene atual e os livres, cada um com uma saída
+ * distinta para um livre ou para o 0, sem laços. A solução é mantida de
+ * forma incremental: fixar a aresta (atual, prox) retira uma linha e uma
+ * coluna e pede no máximo um caminho de aumento, O(k^2) para k genes
+ * livres, com os potenciais guardados por profundidade para desfazer.
+ *
+ * Carpaneto & Toth (1980). Some New Branching and Bounding Criteria for
+ * the Asymmetric Travelling Salesman Problem. Management Science, 26(7),
+ * 736–743.
+ *
+ * Os filhos são visitados em ordem de custo reduzido e a
+ * busca para ao atingir maxNos, devolvendo a melhor rota encontrada até
+ * então. Funciona também para genes reduzidos, onde o custo não é
+ * simétrico.
+ *
+ **/
+int TExato::branchBound (TIndividuo *individuo, long maxNos)
+{
+   int n = individuo->get_qtdeGenes();
+   if (n<4) return 0;
+
+   VP_n = n;
+   VP_nos = 0;
+   VP_maxNos = maxNos;
+
+   VP_c.resize(n*n);
+   for (int a=0; a<n; a++)
+      for (int b=0; b<n; b++)
+         VP_c[a*n+b] = VP_Mapa->get_distancia(individuo->get_por_id(a)->ori, individuo->get_por_id(b)->dest);
+
+   //A solução inicial é o próprio indivíduo
+   VP_melhor = individuo->get_distancia();
+   VP_melhorRota.clear();
+
+   VP_livre.assign(n, 1);
+   VP_rota.assign(n, 0);
+   VP_livre[0] = 0;
+
+   //Designação completa da raiz, uma linha de cada vez
+   VP_u.assign(n, 0);
+   VP_v.assign(n, 0);
+   VP_colDe.assign(n, -1);
+   VP_linhaDe.assign(n, -1);
+   VP_minv.resize(n);
+   VP_via.resize(n);
+   VP_usada.resize(n);
+   VP_pilhaU.resize(n*n);
+   VP_pilhaV.resize(n*n);
+   VP_pilhaCol.resize(n*n);
+   VP_pilhaLinha.resize(n*n);
+   VP_filhos.resize(n*n);
+   VP_reduzido.resize(n*n);
+   for (int a=0; a<n; a++) aumenta(a);
+
+   //Sem folga na raiz, a rota do indivíduo já é ótima
+   double limite = designacao();
+   if (limite<VP_melhor) ramifica(0, 1, 0, limite);
+
+   VP_c.clear();
+
+   if (VP_melhorRota.empty()) return 0;
+
+   individuo->reordena(VP_melhorRota);
+   return 1;
+}
+
+//Caminho de aumento de menor custo reduzido a partir da linha livre,
+//sobre as colunas ativas (Dijkstra com os potenciais)
+void TExato::aumenta (int linha)
+{
+   int n = VP_n;
+   for (int b=0; b<n; b++)
+   {
+      VP_minv[b] = INFINITY;
+      VP_usada[b] = 0;
+   }
+
+   int a = linha;
+   int col = -1;
+   while (true)
+   {
+      double delta = INFINITY;
+      int escolha = -1;
+      for (int b=0; b<n; b++)
+      {
+         if ((VP_usada[b])||(!colunaAtiva(b))) continue;
+         if (b!=a)
+         {
+            double reduzido = VP_c[a*n+b] - VP_u[a] - VP_v[b];
+            if (reduzido<VP_minv[b])
+            {
+               VP_minv[b] = reduzido;
+               VP_via[b] = col;
+            }
+         }
+         if (VP_minv[b]<delta)
+         {
+            delta = VP_minv[b];
+            escolha = b;
+         }
+      }
+
+      VP_u[linha] += delta;
+      for (int b=0; b<n; b++)
+      {
+         if (!colunaAtiva(b)) continue;
+         if (VP_usada[b])
+         {
+            VP_u[VP_linhaDe[b]] += delta;
+            VP_v[b] -= delta;
+         }
+         else VP_minv[b] -= delta;
+      }
+
+      VP_usada[escolha] = 1;
+      col = escolha;
+      if (VP_linhaDe[col]==-1) break;
+      a = VP_linhaDe[col];
+   }
+
+   //Inverte o caminho
+   while (col!=-1)
+   {
+      int ant = VP_via[col];
+      VP_linhaDe[col] = (ant==-1) ? linha : VP_linhaDe[ant];
+      VP_colDe[VP_linhaDe[col]] = col;
+      col = ant;
+   }
+}
+
+double TExato::designacao ()
+{
+   double total = 0;
+   for (int b=0; b<VP_n; b++)
+      if (colunaAtiva(b)) total += VP_c[VP_linhaDe[b]*VP_n+b];
+   return total;
+}
+
+void TExato::salvaDesignacao (int prof)
+{
+   int n = VP_n;
+   copy(VP_u.begin(), VP_u.end(), VP_pilhaU.begin()+prof*n);
+   copy(VP_v.begin(), VP_v.end(), VP_pilhaV.begin()+prof*n);
+   copy(VP_colDe.begin(), VP_colDe.end(), VP_pilhaCol.begin()+prof*n);
+   copy(VP_linhaDe.begin(), VP_linhaDe.end(), VP_pilhaLinha.begin()+prof*n);
+}
+
+void TExato::restauraDesignacao (int prof)
+{
+   int n = VP_n;
+   copy(VP_pilhaU.begin()+prof*n, VP_pilhaU.begin()+(prof+1)*n, VP_u.begin());
+   copy(VP_pilhaV.begin()+prof*n, VP_pilhaV.begin()+(prof+1)*n, VP_v.begin());
+   copy(VP_pilhaCol.begin()+prof*n, VP_pilhaCol.begin()+(prof+1)*n, VP_colDe.begin());
+   copy(VP_pilhaLinha.begin()+prof*n, VP_pilhaLinha.begin()+(prof+1)*n, VP_linhaDe.begin());
+}
+
+//Custo mínimo para completar a rota depois de fixar (atual, prox), com
+//prox já retirado dos livres. Os potenciais continuam viáveis sem a
+//linha e a coluna retiradas, então só a linha que chegava em prox
+//precisa de um novo caminho de aumento
+double TExato::limiteInferior (int atual, int prox)
+{
+   int colAtual = VP_colDe[atual];
+   VP_colDe[atual] = -1;
+
+   if (colAtual!=prox)
+   {
+      int linha = VP_linhaDe[prox];
+      VP_linhaDe[prox] = -1;
+      VP_linhaDe[colAtual] = -1;
+      VP_colDe[linha] = -1;
+      aumenta(linha);
+   }
+   else VP_linhaDe[prox] = -1;
+
+   return designacao();
+}
+
+void TExato::ramifica (int atual, int prof, double custo, double limite)
+{
+   int n = VP_n;
+
+   if (prof==n)
+   {
+      custo += VP_c[atual*n];
+      if (custo<VP_melhor)
+      {
+         VP_melhor = custo;
+         VP_melhorRota = VP_rota;
+      }
+      return;
+   }
+
+   salvaDesignacao(prof);
+
+   //Filhos em ordem de custo reduzido, começando pela aresta da
+   //designação. Com os potenciais do pai, o limite de cada filho é pelo
+   //menos o do pai mais o custo reduzido, sem caminho de aumento
+   int *filhos = &VP_filhos[prof*n];
+   double *reduzido = &VP_reduzido[prof*n];
+   int qtde = 0;
+   for (int b=1; b<n; b++)
+   {
+      if (!VP_livre[b]) continue;
+      reduzido[b] = VP_c[atual*n+b] - VP_u[atual] - VP_v[b];
+      filhos[qtde++] = b;
+   }
+   sort(filhos, filhos+qtde, [&](int x, int y) { return reduzido[x] < reduzido[y]; });
+
+   for (int k=0; k<qtde; k++)
+   {
+      if (VP_nos>=VP_maxNos) return;
+
+      int prox = filhos[k];
+      if (custo+limite+reduzido[prox]>=VP_melhor) break;
+
+      double novoCusto = custo + VP_c[atual*n+prox];
+
+      VP_nos++;
+      VP_livre[prox] = 0;
+      VP_rota[prof] = prox;
+
+      double limFilho = limiteInferior(atual, prox);
+      if (novoCusto+limFilho<VP_melhor)
+         ramifica(prox, prof+1, novoCusto, limFilho);
+
+      VP_livre[prox] = 1;
+      restauraDesignacao(prof);
+   }
+}
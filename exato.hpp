@@ -0,0 +1,83 @@
+/*
+*  exato.hpp
+*
+*  Módulo responsável pelos métodos exatos, utilizados quando a
+*  quantidade de genes (reduzida pela recursividade) é pequena
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#ifndef _EXATO_H
+#define	_EXATO_H
+
+#include <vector>
+#include "individuo.hpp"
+#include "tsp.hpp"
+
+//Limite de genes para a programação dinâmica.
+//A tabela ocupa 2^(n-1) * (n-1) doubles, com n=19 são ~38MB
+const int maxGenesPD = 19;
+
+//Limite de genes e de nós explorados pelo branch-and-bound. Com o
+//limite da designação, acima de ~23 genes a busca raramente fecha
+//dentro de maxNosBB nós e passa a ser só uma busca local cara
+const int maxGenesBB = 22;
+const long maxNosBB = 200000;
+
+class TExato
+{
+   private:
+      TMapaGenes *VP_Mapa;
+
+      //Estado do branch-and-bound
+      int VP_n;
+      long VP_nos;
+      long VP_maxNos;
+      double VP_melhor;
+      vector<double> VP_c;
+      vector<char> VP_livre;
+      vector<int> VP_rota;
+      vector<int> VP_melhorRota;
+
+      //Problema de designação do limite inferior: potenciais das linhas
+      //(saídas) e das colunas (chegadas), coluna de cada linha e linha
+      //de cada coluna (-1 = livre)
+      vector<double> VP_u;
+      vector<double> VP_v;
+      vector<int> VP_colDe;
+      vector<int> VP_linhaDe;
+      //Cópias por profundidade, para desfazer ao voltar na árvore
+      vector<double> VP_pilhaU;
+      vector<double> VP_pilhaV;
+      vector<int> VP_pilhaCol;
+      vector<int> VP_pilhaLinha;
+      //Áreas de trabalho do caminho de aumento
+      vector<double> VP_minv;
+      vector<int> VP_via;
+      vector<char> VP_usada;
+      //Filhos de cada profundidade e os seus custos reduzidos
+      vector<int> VP_filhos;
+      vector<double> VP_reduzido;
+
+      bool colunaAtiva (int b) { return (b==0)||VP_livre[b]; }
+      void aumenta (int linha);
+      double designacao ();
+      void salvaDesignacao (int prof);
+      void restauraDesignacao (int prof);
+      double limiteInferior (int atual, int prox);
+      void ramifica (int atual, int prof, double custo, double limite);
+
+   public:
+      TExato (TMapaGenes *mapa);
+
+      //Held-Karp. Retorna 1 quando encontra uma rota melhor do que a do indivíduo
+      int heldKarp (TIndividuo *individuo);
+      //Branch-and-bound limitado a maxNos nós. Retorna 1 quando melhora o indivíduo
+      int branchBound (TIndividuo *individuo, long maxNos);
+};
+
+#endif
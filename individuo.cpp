@@ -11,14 +11,23 @@
 */
 
 #include "individuo.hpp"
+#include "exato.hpp"
 #include <iostream>
 
 //Apenas letura
 TMapaGenes *TIndividuo::getMapa() { return VP_Mapa; }
 TArqLog *TIndividuo::getArqLog()  { return VP_ArqSaida; }
 
-int TIndividuo::get_extra ()         { return VP_Extra; }
-void TIndividuo::set_extra (int val) { VP_Extra = val; }
+int TIndividuo::get_extra ()
+{
+   for (int id=0; id<VP_qtdeGenes; id++)
+      if (!VP_naoOlhar[id]) return 0;
+   return 1;
+}
+void TIndividuo::set_extra (int val) { VP_naoOlhar.assign(VP_qtdeGenes, val?1:0); }
+
+int TIndividuo::get_naoOlhar (int id)           { return VP_naoOlhar[id]; }
+void TIndividuo::set_naoOlhar (int id, int val) { VP_naoOlhar[id] = val?1:0; }
 
 double TIndividuo::get_distancia() { return VP_dist; }
 
@@ -36,15 +45,22 @@ TGene *TIndividuo::ant (int idG) { return VP_direto[idG]->ant; }
 
 int TIndividuo::get_qtdeGenes() { return VP_qtdeGenes; }
 
+bool TIndividuo::simetrico()
+{
+   //Genes reduzidos pela recursividade (ori!=dest) nunca são simétricos
+   return VP_genesSimples && VP_Mapa->simetrico();
+}
+
 //Métodos
 TIndividuo::TIndividuo (TMapaGenes *mapa, TArqLog *arqSaida)
 {
    VP_Mapa = mapa;
    VP_ArqSaida = arqSaida;
 
-   VP_Extra = 0;
    VP_dist = 0;
+   VP_qtdeGenes = 0;
    VP_qtdeGeneAlloc = 0;
+   VP_genesSimples = true;
 }
 
 TIndividuo::~TIndividuo()
@@ -83,7 +99,7 @@ void TIndividuo::novo ()
    VP_direto[0]->ant = VP_direto[VP_qtdeGenes-1];
 
    //Se o indivíduo foi modificado, o 2opt deve começar do início
-   VP_Extra = 0;
+   inicializa();
 
    VP_dist += VP_Mapa->get_distancia(VP_direto[VP_qtdeGenes-1]->ori, VP_direto[0]->dest);
 }
@@ -117,7 +133,8 @@ void TIndividuo::novo (vector<TTipoConversao> genes, int extraPadrao)
    VP_indice[0]->ant = VP_indice[VP_qtdeGenes-1];
 
    //Se o indivíduo foi modificado, o 2opt deve começar do início
-   VP_Extra = extraPadrao;
+   inicializa();
+   set_extra(extraPadrao);
 
    VP_dist += VP_Mapa->get_distancia(VP_indice[VP_qtdeGenes-1]->ori, VP_indice[0]->dest);	
 }
@@ -153,11 +170,20 @@ void TIndividuo::novo (vector<TGene *> genes)
    VP_indice[0]->ant = VP_indice[VP_qtdeGenes-1];
 
    //Se o indivíduo foi modificado, o 2opt deve começar do início
-   VP_Extra = 0;
+   inicializa();
 
    VP_dist += VP_Mapa->get_distancia(VP_indice[VP_qtdeGenes-1]->ori, VP_indice[0]->dest);
 }
 
+void TIndividuo::inicializa ()
+{
+   VP_genesSimples = true;
+   for (int i=0; i<VP_qtdeGenes; i++)
+      if (VP_direto[i]->ori!=VP_direto[i]->dest) VP_genesSimples = false;
+
+   VP_naoOlhar.assign(VP_qtdeGenes, 0);
+}
+
 string TIndividuo::toString ()
 {
    string resultado = "";
@@ -212,6 +238,25 @@ void TIndividuo::troca_indice(int index1, int index2)
 {
    if ((index1==0)||(index2==0)||(index1==index2)) return;
 
+   permuta(index1, index2);
+
+   //Apenas as arestas em volta dos 2 genes foram alteradas
+   acorda(index1);
+   acorda(ind_prox(index1));
+   acorda(index2);
+   acorda(ind_prox(index2));
+}
+
+void TIndividuo::acorda(int indice)
+{
+   VP_naoOlhar[VP_indice[indice]->id] = 0;
+   VP_naoOlhar[VP_indice[ind_ant(indice)]->id] = 0;
+}
+
+void TIndividuo::permuta(int index1, int index2)
+{
+   if ((index1==0)||(index2==0)||(index1==index2)) return;
+
    TGene *tempG;
 
    if(index1>index2)
@@ -322,11 +367,24 @@ void TIndividuo::troca_sub(int index1, int size1, int index2, int size2)
 
    //Remontando o indivíduo
    //o segundo bloco passa a ser o prmeiro
-   for (int i = 0, j=index1; i<size2; i++, j++) this->troca (this->VP_indice[j]->id, v2[i]); 
+   for (int i = 0, j=index1; i<size2; i++, j++) this->permuta (j, VP_direto[v2[i]]->i); 
    //O bloco do meio
-   for(int i = 0, j=index1+size2; i<index2-index1-size1; i++, j++) this->troca (this->VP_indice[j]->id,vm[i]);
+   for(int i = 0, j=index1+size2; i<index2-index1-size1; i++, j++) this->permuta (j, VP_direto[vm[i]]->i);
    //o prmeiro bloco passará a ser o segundo
-   for (int i = 0, j=index2+size2-size1; i<size1; i++, j++) this->troca (this->VP_indice[j]->id, v1[i]); 	
+   for (int i = 0, j=index2+size2-size1; i<size1; i++, j++) this->permuta (j, VP_direto[v1[i]]->i); 	
+
+   //As arestas internas dos blocos são mantidas, exceto quando um bloco
+   //invertido muda o custo das suas arestas
+   if (((increment1<0)||(increment2<0))&&(!simetrico()))
+   {
+      for (int j=index1; j<=index2+size2; j++) acorda(j%VP_qtdeGenes);
+      return;
+   }
+
+   acorda(index1);
+   acorda((index1+size2)%VP_qtdeGenes);
+   acorda((index2+size2-size1)%VP_qtdeGenes);
+   acorda((index2+size2)%VP_qtdeGenes);
 }
 
 void TIndividuo::embaralha ()
@@ -403,6 +461,118 @@ double TIndividuo::get_dist_sub_reverso_indice(int indice1, int indice2)
    return get_dist_sub_reverso (VP_indice[indice1], VP_indice[indice2]);
 }
 
+//Mesmas arestas do troca_indice, O(1)
+double TIndividuo::get_delta_troca (int index1, int index2)
+{
+   if ((index1==0)||(index2==0)||(index1==index2)) return 0;
+
+   if (index1>index2)
+   {
+      int i = index1;
+      index1 = index2;
+      index2 = i;
+   }
+
+   TGene *a  = VP_indice[index1];
+   TGene *b  = VP_indice[index2];
+   TGene *pa = VP_indice[ind_ant(index1)];
+   TGene *pb = VP_indice[ind_ant(index2)];
+   TGene *na = VP_indice[ind_prox(index1)];
+   TGene *nb = VP_indice[ind_prox(index2)];
+
+   //pa a b nb  =>  pa b a nb
+   if (na==b)
+      return VP_Mapa->get_distancia(pa->ori, b->dest) + VP_Mapa->get_distancia(b->ori, a->dest) +
+             VP_Mapa->get_distancia(a->ori, nb->dest) - VP_Mapa->get_distancia(pa->ori, a->dest) -
+             VP_Mapa->get_distancia(a->ori, b->dest) - VP_Mapa->get_distancia(b->ori, nb->dest);
+
+   return VP_Mapa->get_distancia(pa->ori, b->dest) + VP_Mapa->get_distancia(b->ori, na->dest) +
+          VP_Mapa->get_distancia(pb->ori, a->dest) + VP_Mapa->get_distancia(a->ori, nb->dest) -
+          VP_Mapa->get_distancia(pa->ori, a->dest) - VP_Mapa->get_distancia(a->ori, na->dest) -
+          VP_Mapa->get_distancia(pb->ori, b->dest) - VP_Mapa->get_distancia(b->ori, nb->dest);
+}
+
+//O(1) quando os custos são simétricos. Senão as arestas internas
+//mudam de sentido e a conta é a do get_dist_sub_reverso
+double TIndividuo::get_delta_inversao (int indice1, int indice2)
+{
+   if ((indice1==0)||(indice2==0)||(indice1==indice2)) return 0;
+
+   if (indice1>indice2)
+   {
+      int i = indice1;
+      indice1 = indice2;
+      indice2 = i;
+   }
+
+   if (!simetrico()) return get_dist_sub_reverso_indice(indice1, indice2) - VP_dist;
+
+   TGene *a  = VP_indice[indice1];
+   TGene *b  = VP_indice[indice2];
+   TGene *pa = VP_indice[ind_ant(indice1)];
+   TGene *nb = VP_indice[ind_prox(indice2)];
+
+   return VP_Mapa->get_distancia(pa->ori, b->dest) + VP_Mapa->get_distancia(a->ori, nb->dest) -
+          VP_Mapa->get_distancia(pa->ori, a->dest) - VP_Mapa->get_distancia(b->ori, nb->dest);
+}
+
+//O gene g sai de entre pg e ng e entra entre x e y, O(1)
+double TIndividuo::get_delta_insercao (int de, int para)
+{
+   if ((de==0)||(para==0)||(de==para)) return 0;
+
+   TGene *g  = VP_indice[de];
+   TGene *pg = VP_indice[ind_ant(de)];
+   TGene *ng = VP_indice[ind_prox(de)];
+
+   //Com a retirada, os genes entre de e para andam uma posição
+   TGene *x = (para>de)?VP_indice[para]:VP_indice[para-1];
+   TGene *y = (para>de)?VP_indice[ind_prox(para)]:VP_indice[para];
+
+   return VP_Mapa->get_distancia(pg->ori, ng->dest) - VP_Mapa->get_distancia(pg->ori, g->dest) -
+          VP_Mapa->get_distancia(g->ori, ng->dest) + VP_Mapa->get_distancia(x->ori, g->dest) +
+          VP_Mapa->get_distancia(g->ori, y->dest) - VP_Mapa->get_distancia(x->ori, y->dest);
+}
+
+void TIndividuo::insere_indice (int de, int para)
+{
+   if ((de==0)||(para==0)||(de==para)) return;
+
+   VP_dist += get_delta_insercao(de, para);
+
+   //Retirando o gene do encadeamento
+   TGene *g = VP_indice[de];
+   g->ant->prox = g->prox;
+   g->prox->ant = g->ant;
+   VP_naoOlhar[g->ant->id] = 0;
+   VP_naoOlhar[g->prox->id] = 0;
+
+   if (de<para)
+      for (int k=de; k<para; k++)
+      {
+         VP_indice[k] = VP_indice[k+1];
+         VP_indice[k]->i = k;
+      }
+   else
+      for (int k=de; k>para; k--)
+      {
+         VP_indice[k] = VP_indice[k-1];
+         VP_indice[k]->i = k;
+      }
+
+   VP_indice[para] = g;
+   g->i = para;
+
+   //Incluindo na nova posição
+   g->ant = VP_indice[ind_ant(para)];
+   g->prox = VP_indice[ind_prox(para)];
+   g->ant->prox = g;
+   g->prox->ant = g;
+
+   acorda(para);
+   acorda(ind_prox(para));
+}
+
 void TIndividuo::inverte_sub_indice (int indice1, int indice2)
 {
    int i;
@@ -415,7 +585,13 @@ void TIndividuo::inverte_sub_indice (int indice1, int indice2)
    }
 
    for (i=0; i<=(indice2-indice1)/2;i++)
-      troca_indice(indice1+i, indice2-i);
+      permuta(indice1+i, indice2-i);
+
+   //Com custos simétricos só mudam as arestas das pontas
+   acorda(indice1);
+   acorda(ind_prox(indice2));
+   if (!simetrico())
+      for (i=indice1+1; i<=indice2; i++) acorda(i);
 }
 
 void TIndividuo::inverte_sub (TGene *G1, TGene *G2)
@@ -428,55 +604,95 @@ void TIndividuo::inverte_sub_id (int id1, int id2)
    inverte_sub_indice (VP_direto[id1]->i, VP_direto[id2]->i);
 }
 
+//Reorganiza o indivíduo na sequência de ids informada.
+//Os genes são os mesmos, apenas o encadeamento é refeito, O(n)
+void TIndividuo::reordena (vector<int> &ids)
+{
+   for (int k=0; k<VP_qtdeGenes; k++)
+   {
+      VP_indice[k] = VP_direto[ids[k]];
+      VP_indice[k]->i = k;
+   }
+
+   for (int k=0; k<VP_qtdeGenes; k++)
+   {
+      VP_indice[k]->prox = VP_indice[ind_prox(k)];
+      VP_indice[k]->ant  = VP_indice[ind_ant(k)];
+   }
+
+   //Se o indivíduo foi modificado, o 2opt deve começar do início
+   inicializa();
+
+   recalcDist();
+}
+
 //Clona o individuo. Necessário para o elitismo
 TIndividuo *TIndividuo::clona ()
 {
    TIndividuo *clone = new TIndividuo(getMapa(), getArqLog());
    clone->novo(VP_indice);
-   clone->set_extra(get_extra());
+   clone->VP_naoOlhar = VP_naoOlhar;
    return clone;
 }
 
-int TIndividuo::melhorPossivel()
+void TIndividuo::copia (TIndividuo *origem)
 {
-   int melhorou = 0; //retrna false (=0) quando não mehora ou true (!=0) quando melhora 
-   vector<TGene *> melhor;
-   vector<TGene *> temp;
-   double melhorDist = get_distancia();
-   double distTemp;
-
-   //Realizando todas as combinações, fixando o 0, pois é um ciclo
-   for(int i=1;i<get_qtdeGenes();++i) temp.push_back(get_por_id(i));
-
-   do
+   if (VP_qtdeGenes!=origem->VP_qtdeGenes)
    {
-      //Calculando o peso total de cada permutação
-      distTemp = VP_Mapa->get_distancia(VP_direto[0]->ori, temp[0]->dest);
-      for (unsigned i=1;i<temp.size();++i) distTemp += VP_Mapa->get_distancia(temp[i-1]->ori, temp[i]->dest);
-      distTemp += VP_Mapa->get_distancia(temp[temp.size()-1]->ori ,VP_direto[0]->dest);
+      for (vector< TGene *>::iterator i=VP_indice.begin(); i!=VP_indice.end(); ++i)
+         delete (*i);
+      VP_indice.clear();
+      VP_direto.clear();
 
-      if (distTemp<melhorDist)
+      novo(origem->VP_indice);
+   }
+   else
+   {
+      for (int k=0; k<VP_qtdeGenes; k++)
       {
-         melhorDist = distTemp;
-         melhor = temp;
+         TGene *o = origem->VP_indice[k];
+         TGene *g = VP_direto[o->id];
+         g->ori  = o->ori;
+         g->dest = o->dest;
+         g->i    = k;
+         VP_indice[k] = g;
       }
-   }while(next_permutation(temp.begin(),temp.end()));
 
-   //Se encontrei combinação melhor do que a existente
-   if (melhorDist<get_distancia())
-   {
-      melhorou = 1;
-      //Mudo o individuo para mesma sequência do melhor
-      for (int i=1;i<get_qtdeGenes()-1;++i)
+      for (int k=0; k<VP_qtdeGenes; k++)
       {
-         if (VP_indice[i]->id!=melhor[i-1]->id)
-            troca_indice(i, (get_por_id(melhor[i-1]->id))->i);
+         VP_indice[k]->prox = VP_indice[ind_prox(k)];
+         VP_indice[k]->ant  = VP_indice[ind_ant(k)];
       }
+
+      VP_dist = origem->VP_dist;
+   }
+
+   VP_genesSimples = origem->VP_genesSimples;
+   VP_naoOlhar = origem->VP_naoOlhar;
+}
+
+//Um gene só continua sem precisar ser olhado se as suas duas
+//arestas forem as mesmas do pai
+void TIndividuo::herdaNaoOlhar (TIndividuo *pai)
+{
+   bool sim = simetrico();
+
+   for (int id=0; id<VP_qtdeGenes; id++)
+   {
+      if ((VP_naoOlhar[id])||(!pai->VP_naoOlhar[id])) continue;
+
+      TGene *g = VP_direto[id];
+      TGene *p = pai->VP_direto[id];
+
+      if (((g->ant->id==p->ant->id)&&(g->prox->id==p->prox->id))||
+          (sim&&(g->ant->id==p->prox->id)&&(g->prox->id==p->ant->id)))
+         VP_naoOlhar[id] = 1;
    }
-   
-   melhor.clear();
-   temp.clear();
-   
-   return melhorou;
 }
 
+int TIndividuo::melhorPossivel()
+{
+   //retorna false (=0) quando não melhora ou true (!=0) quando melhora
+   TExato exato(VP_Mapa);
+   return exato.heldKarp(this);
+}
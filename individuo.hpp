@@ -27,7 +27,10 @@ class indivíduo. Uma sequência de genes encadeados
 class TIndividuo
 {
    private:
-      int VP_Extra;
+      //Don't look bits, por id do gene. 1 indica que nenhum movimento a partir
+      //do gene melhorou a rota na última busca local e que suas arestas não
+      //foram alteradas desde então
+      vector <char> VP_naoOlhar;
 
       vector <TGene *> VP_direto;
       vector <TGene *> VP_indice;
@@ -37,9 +40,19 @@ class TIndividuo
 
       int VP_qtdeGeneAlloc;
 
+      //Todos os genes com ori==dest (não reduzidos)
+      bool VP_genesSimples;
+
       TMapaGenes *VP_Mapa;
       TArqLog *VP_ArqSaida;
 
+      //Troca a posição de 2 genes sem alterar os don't look bits
+      void permuta(int index1, int index2);
+      //Limpa o don't look bit das 2 pontas da aresta que chega no índice
+      void acorda(int indice);
+      //Verifica se os genes foram reduzidos e limpa os don't look bits
+      void inicializa();
+
    public:
 
       //Apenas leitura
@@ -47,8 +60,11 @@ class TIndividuo
       TArqLog *getArqLog();
 
       //Propriedades
+      //extra = 1 quando todos os don't look bits estão marcados
       int get_extra ();
       void set_extra (int val);
+      int get_naoOlhar (int id);
+      void set_naoOlhar (int id, int val);
 
       //Métodos
       TIndividuo (TMapaGenes *mapa, TArqLog *arqSaida);
@@ -71,6 +87,9 @@ class TIndividuo
 
       double get_distancia ();
 
+      //Se o custo entre os genes independe do sentido (ori==dest e mapa simétrico)
+      bool simetrico ();
+
       //Cria um novo indivíduo
       void novo ();
       //Cria um novo indivíduo a partir de um vetor de genes
@@ -105,13 +124,31 @@ class TIndividuo
       double get_dist_sub_reverso_id(int id1, int id2);
       double get_dist_sub_reverso_indice(int indice1, int indice2);
 
+      //Variação da distância de cada movimento, sem aplicá-lo
+      double get_delta_troca (int index1, int index2);
+      double get_delta_inversao (int indice1, int indice2);
+      double get_delta_insercao (int de, int para);
+
+      //Retira o gene da posição de e o insere na posição para
+      void insere_indice (int de, int para);
+
       //Inverte o caminho de uma sub-rota
       void inverte_sub_indice (int indice1, int indice2);
       void inverte_sub (TGene *G1, TGene *G2);
       void inverte_sub_id (int id1, int id2);
 
+      //Reorganiza o indivíduo na sequência de ids informada (ids[0] = 0)
+      void reordena (vector<int> &ids);
+
+      //Mantém os don't look bits do pai nos genes com os mesmos vizinhos
+      void herdaNaoOlhar (TIndividuo *pai);
+
       //Clona o individuo. Necessário para o elitismo
       TIndividuo *clona ();
+      //Torna o indivíduo igual à origem, reaproveitando os genes
+      //já alocados quando a quantidade é a mesma
+      void copia (TIndividuo *origem);
+      //Melhor combinação possível dos genes (Held-Karp)
       int melhorPossivel ();
 };
 
@@ -15,6 +15,7 @@
 *
 *  Os parametros de entrada estão explicados no arquivo tsphelp.txt
 *  A compilação pode ser realizada pelo comando make
+*  É necessário compilar com -pthread (varredura do 2-opt e do 3-opt)
 *
 *  Se não for definido parametros de entrada, serão utilizados os
 *  parametros padrões, conforme abaixo.
@@ -156,6 +157,58 @@ int main(int argc, char *argv[])
       cabecalho  += to_string(config->selIndMutacao);
       cabecalho  += "\n";
 
+      cabecalho  += "Vizinhos Candidatos;";
+      cabecalho  += to_string(config->numCandidatos);
+      cabecalho  += "\n";
+
+      cabecalho  += "Profundidade do Lin-Kernighan;";
+      cabecalho  += to_string(config->profundidadeLK);
+      cabecalho  += "\n";
+
+      cabecalho  += "Threads;";
+      cabecalho  += to_string(config->numThreads);
+      cabecalho  += "\n";
+
+      cabecalho  += "Máximo de Avaliações por Mutação;";
+      cabecalho  += to_string(config->maxAvaliacoes);
+      cabecalho  += "\n";
+
+      cabecalho  += "Tempo Máximo por Mutação (us);";
+      cabecalho  += to_string(config->maxTempoMutacao);
+      cabecalho  += "\n";
+
+      cabecalho  += "Temperatura Inicial SA;";
+      cabecalho  += to_string(config->temperaturaSA);
+      cabecalho  += "\n";
+
+      cabecalho  += "Resfriamento SA (1/10000);";
+      cabecalho  += to_string(config->resfriamentoSA);
+      cabecalho  += "\n";
+
+      cabecalho  += "Iterações SA;";
+      cabecalho  += to_string(config->iteracoesSA);
+      cabecalho  += "\n";
+
+      cabecalho  += "Filhos EAX;";
+      cabecalho  += to_string(config->filhosEAX);
+      cabecalho  += "\n";
+
+      cabecalho  += "Estratégia EAX;";
+      cabecalho  += to_string(config->estrategiaEAX);
+      cabecalho  += "\n";
+
+      cabecalho  += "Poda de filhos;";
+      cabecalho  += to_string(config->podaFilhos);
+      cabecalho  += "\n";
+
+      cabecalho  += "Tamanho do Torneio;";
+      cabecalho  += to_string(config->tamTorneio);
+      cabecalho  += "\n";
+
+      cabecalho  += "Modo do AG;";
+      cabecalho  += to_string(config->modoAG);
+      cabecalho  += "\n";
+
       arqSaida = new TArqLog(cabecalho, nomeArqSaida);
       ag = new TAlgGenetico(mapa, arqSaida);
       ag->setMutacao(config->mutacao);
@@ -170,6 +223,19 @@ int main(int argc, char *argv[])
       ag->setSelIndMutacao(config->selIndMutacao);
       ag->setAtivaRecursivo(config->ativaRecursivo);
       ag->setPercentReducao(config->percentReducao);
+      ag->setNumCandidatos(config->numCandidatos);
+      ag->setProfundidadeLK(config->profundidadeLK);
+      ag->setNumThreads(config->numThreads);
+      ag->setMaxAvaliacoes(config->maxAvaliacoes);
+      ag->setMaxTempoMutacao(config->maxTempoMutacao);
+      ag->setTemperaturaSA(config->temperaturaSA);
+      ag->setResfriamentoSA(config->resfriamentoSA);
+      ag->setIteracoesSA(config->iteracoesSA);
+      ag->setFilhosEAX(config->filhosEAX);
+      ag->setEstrategiaEAX(config->estrategiaEAX);
+      ag->setPodaFilhos(config->podaFilhos);
+      ag->setTamTorneio(config->tamTorneio);
+      ag->setModoAG(config->modoAG);
       ag->exec();
 
       arqSaida->addLinha("");
@@ -12,21 +12,86 @@
 
 #include "mutacao.hpp"
 #include <iostream>
+#include <cmath>
 
 //Apenas letura
 TMapaGenes *TMutacao::getMapa() { return VP_Mapa; }
 TArqLog *TMutacao::getArqLog()  { return VP_ArqSaida; }
 
+void TMutacao::setNumCandidatos (int val) { VP_numCandidatos = val; }
+int TMutacao::getNumCandidatos ()         { return VP_numCandidatos; }
+void TMutacao::setProfundidadeLK (int val) { VP_profundidadeLK = val; }
+int TMutacao::getProfundidadeLK ()        { return VP_profundidadeLK; }
+void TMutacao::setNumThreads (int val)     { VP_numThreads = val; }
+int TMutacao::getNumThreads ()            { return VP_numThreads; }
+void TMutacao::setMaxAvaliacoes (int val)  { VP_maxAvaliacoes = val; }
+int TMutacao::getMaxAvaliacoes ()         { return VP_maxAvaliacoes; }
+void TMutacao::setMaxTempoMutacao (int val) { VP_maxTempo = val; }
+int TMutacao::getMaxTempoMutacao ()       { return VP_maxTempo; }
+void TMutacao::setTemperaturaSA (int val)  { VP_temperaturaSA = val; }
+int TMutacao::getTemperaturaSA ()         { return VP_temperaturaSA; }
+void TMutacao::setResfriamentoSA (int val) { VP_resfriamentoSA = val; }
+int TMutacao::getResfriamentoSA ()        { return VP_resfriamentoSA; }
+void TMutacao::setIteracoesSA (int val)    { VP_iteracoesSA = val; }
+int TMutacao::getIteracoesSA ()           { return VP_iteracoesSA; }
+
 TMutacao::TMutacao (TMapaGenes *mapa, TArqLog *arqSaida, int tipoMutacao)
 {
    VP_Mapa = mapa;
    VP_ArqSaida = arqSaida;
    VP_mutacao = tipoMutacao;
+   VP_numCandidatos = 8;
+   VP_profundidadeLK = 5;
+   VP_numThreads = 0;
+   VP_temperaturaSA = 0;
+   VP_resfriamentoSA = 9990;
+   VP_iteracoesSA = 5000;
+   VP_Candidatos = NULL;
+   VP_ganho = 0;
+   VP_usosTotal = 0;
+   VP_maxAvaliacoes = 0;
+   VP_maxTempo = 0;
+   VP_avaliacoes = 0;
+   VP_esgotado = false;
+}
+
+TMutacao::~TMutacao ()
+{
+   if (VP_Candidatos) delete VP_Candidatos;
 }
 
 int TMutacao::processa (TIndividuo *individuo)
 {
-   switch (VP_mutacao)
+   //O orçamento vale para a chamada inteira, inclusive
+   //quando a escolha adaptativa repassa para outro operador
+   VP_avaliacoes = 0;
+   VP_esgotado = false;
+   if (VP_maxTempo) VP_inicio = chrono::steady_clock::now();
+
+   return executa(VP_mutacao, individuo);
+}
+
+//O relógio só é consultado a cada 256 avaliações
+bool TMutacao::esgotado (long qtde)
+{
+   if (VP_esgotado) return true;
+   if ((!VP_maxAvaliacoes)&&(!VP_maxTempo)) return false;
+   if (qtde<1) qtde = 1;
+
+   long tot = (VP_avaliacoes += qtde);
+   if ((VP_maxAvaliacoes)&&(tot>VP_maxAvaliacoes)) VP_esgotado = true;
+   else if ((VP_maxTempo)&&((tot>>8)!=((tot-qtde)>>8)))
+   {
+      if (chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - VP_inicio).count() > VP_maxTempo)
+         VP_esgotado = true;
+   }
+
+   return VP_esgotado;
+}
+
+int TMutacao::executa (int tipo, TIndividuo *individuo)
+{
+   switch (tipo)
    {
       case 0:
       {
@@ -63,6 +128,41 @@ int TMutacao::processa (TIndividuo *individuo)
          return threeOPT2(individuo);
          break;
       }
+      case 7:
+      {
+         return twoOPTViz(individuo);
+         break;
+      }
+      case 8:
+      {
+         return orOPT(individuo);
+         break;
+      }
+      case 9:
+      {
+         return LK(individuo);
+         break;
+      }
+      case 10:
+      {
+         return threeOPTViz(individuo);
+         break;
+      }
+      case mutacaoAdaptativa:
+      {
+         return adaptativa(individuo);
+         break;
+      }
+      case 12:
+      {
+         return ILS(individuo);
+         break;
+      }
+      case 13:
+      {
+         return SA(individuo);
+         break;
+      }
       default:
       {
          break;
@@ -130,28 +230,29 @@ int TMutacao::twoOPT(TIndividuo *individuo)
    //menos de 4 vértices
    if (individuo->get_qtdeGenes()<4) return 0;
 
-   double diff;
-   double melhor;
-   int Ci = -1, Cj = -1;
-   melhor = individuo->get_distancia();
+   double melhor = individuo->get_distancia();
 
-   for(int i = 1; i < individuo->get_qtdeGenes(); i++)
+   //A varredura é só leitura, as linhas i são divididas entre as threads
+   TMovimento mov = {melhor, -1, -1, -1, -1};
+   if (individuo->simetrico())
    {
-      for(int j = i + 2; j < individuo->get_qtdeGenes() - 2; j++)
-      {
-         diff = individuo->get_dist_sub_reverso_indice(i, j);
-
-         if(diff < melhor)
-         {
-				melhor = diff;
-				Ci = i;
-				Cj = j;
-			}
-		}
-	}
+      //Rota em vetor para o cálculo vetorizado da variação
+      int n = individuo->get_qtdeGenes();
+      vector<int> c (n);
+      vector<double> e (n);
+      for (int p=0; p<n; p++) c[p] = individuo->get_por_indice(p)->ori;
+      for (int p=0; p<n; p++) e[p] = VP_Mapa->get_distancia(c[p], c[individuo->ind_prox(p)]);
+
+      paralelo(n, mov,
+               [&](int t, int numThreads, TMovimento &m) { varre2optVetor(c, e, melhor, t, numThreads, m); });
+   }
+   else
+      paralelo(individuo->get_qtdeGenes(), mov,
+               [&](int t, int numThreads, TMovimento &m) { varre2opt(individuo, t, numThreads, m); });
+   melhor = mov.valor;
 
-   if(Ci != -1 && Cj != -1)
-      individuo->inverte_sub_indice(Ci, Cj);
+   if(mov.i != -1 && mov.j != -1)
+      individuo->inverte_sub_indice(mov.i, mov.j);
    else
       individuo->inverte_sub_indice(TUtils::rnd(1, individuo->get_qtdeGenes()-1), TUtils::rnd(1, individuo->get_qtdeGenes()-1));
 
@@ -167,19 +268,27 @@ int TMutacao::twoOPT(TIndividuo *individuo)
  **/
 int TMutacao::twoOPT2(TIndividuo *individuo)
 {
-   if (individuo->get_extra()) return 0;
-
    //O 2-opt não pode ser realizado quando existem
    //menos de 4 vértices
    if (individuo->get_qtdeGenes()<4) return 0;
 
+   vector<char> olhar;
+   if (!acordados(individuo, olhar)) return 0;
+
    double diff;
    double dist = individuo->get_distancia();
 
    for(int i = 1; i < individuo->get_qtdeGenes()-2; i++)
    {
+      //As inversões já aplicadas são mantidas
+      if (esgotado(individuo->get_qtdeGenes()-i-2)) break;
+
       for(int j = i + 2; j < individuo->get_qtdeGenes(); j++)
       {
+         //Uma das arestas removidas precisa tocar em um gene acordado
+         if (!precisaOlhar(individuo, olhar, i) &&
+             !precisaOlhar(individuo, olhar, individuo->ind_prox(j))) continue;
+
          diff = individuo->get_dist_sub_reverso_indice(i, j);
 
          if(individuo->get_distancia() > diff)
@@ -187,8 +296,9 @@ int TMutacao::twoOPT2(TIndividuo *individuo)
       }
    }
 
-   individuo->set_extra((dist == individuo->get_distancia())?1:0);
-   return individuo->get_extra()^1;
+   if (VP_esgotado) mantemAcordados(individuo, olhar);
+
+   return (dist == individuo->get_distancia())?0:1;
 }
 
 /**
@@ -229,106 +339,22 @@ int TMutacao::threeOPT(TIndividuo *individuo)
    //menos de 6 vértices
    if (individuo->get_qtdeGenes()<6) return 0;
    
-   double gainActual, gainCandidato, diff;
-   int Imas1, Jmas1, Kmas1, Ci = -1, Cj = -1, Ck = -1, op = -1;
+   int Ci, Cj, Ck, op;
    double min, valor = individuo->get_distancia();
    int n = individuo->get_qtdeGenes() - 1;
    min = valor;
 
-   for(int i = 0; i < n - 4; i++)
-   {
-      for(int j = i + 2; j < n - 2; j++)
-      {
-         for(int K = 0; K < 10; K++)
-         {
-            int k = TUtils::rnd(j+2, n-1);
-
-            Imas1 = i + 1;
-            Jmas1 = j + 1;
-            Kmas1 = k + 1;
-
-            TGene *gi = individuo->get_por_indice(i);
-            TGene *gj = individuo->get_por_indice(j);
-            TGene *gk = individuo->get_por_indice(k);
-
-            TGene *gImas1 = individuo->get_por_indice(Imas1);
-            TGene *gJmas1 = individuo->get_por_indice(Jmas1);
-            TGene *gKmas1 = individuo->get_por_indice(Kmas1);
-
-            //operação 1
-            gainActual = VP_Mapa->get_distancia(gi->ori, gImas1->dest) +
-                         VP_Mapa->get_distancia(gj->ori, gJmas1->dest) +
-                         VP_Mapa->get_distancia(gk->ori, gKmas1->dest);
-
-            gainCandidato = VP_Mapa->get_distancia(gi->ori, gj->dest) +
-                            VP_Mapa->get_distancia(gImas1->ori, gk->dest) +
-                            VP_Mapa->get_distancia(gJmas1->ori, gKmas1->dest);
-
-            diff = valor - gainActual + gainCandidato + 
-				       this->calcValReverso(gImas1, gj) +
-				       this->calcValReverso(gJmas1, gk);
-
-            if(min > diff)
-            {
-               op = 0;
-               Ci = i;
-               Cj = j;
-               Ck = k;
-               min = diff;
-            }
-
-            //operação 2
-            gainCandidato = VP_Mapa->get_distancia(gi->ori, gJmas1->dest) +
-                            VP_Mapa->get_distancia(gk->ori, gImas1->dest) +
-                            VP_Mapa->get_distancia(gj->ori, gKmas1->dest);
-
-            diff = valor - gainActual + gainCandidato;
-
-            if(min > diff)
-            {
-               op = 1;
-               Ci = i;
-               Cj = j;
-               Ck = k;
-               min = diff;
-            }
-
-            //operação 3
-            gainCandidato = VP_Mapa->get_distancia(gi->ori, gk->dest) +
-                            VP_Mapa->get_distancia(gJmas1->ori, gImas1->dest) +
-                            VP_Mapa->get_distancia(gj->ori, gKmas1->dest);
-
-            diff = valor - gainActual + gainCandidato +
-                   this->calcValReverso(gJmas1, gk);
-
-            if(min > diff)
-            {
-               op = 2;
-               Ci = i;
-               Cj = j;
-               Ck = k;
-               min = diff;
-            }
-
-            //operação 4
-            gainCandidato = VP_Mapa->get_distancia(gi->ori, gJmas1->dest) +
-                            VP_Mapa->get_distancia(gk->ori, gj->dest) +
-                            VP_Mapa->get_distancia(gImas1->ori, gKmas1->dest);
-
-            diff = valor - gainActual + gainCandidato +
-				       this->calcValReverso(gImas1, gj);
-
-            if(min > diff)
-            {
-               op = 3;
-               Ci = i;
-               Cj = j;
-               Ck = k;
-               min = diff;
-            }
-         }
-      }
-   }
+   //A varredura é só leitura, as linhas i são divididas entre as threads.
+   //Cada thread sorteia os k com o seu próprio gerador
+   unsigned semente = TUtils::rnd(0, RAND_MAX-1);
+   TMovimento mov = {min, -1, -1, -1, -1};
+   paralelo(individuo->get_qtdeGenes(), mov,
+            [&](int t, int numThreads, TMovimento &m) { varre3opt(individuo, semente+t, t, numThreads, m); });
+   min = mov.valor;
+   Ci = mov.i;
+   Cj = mov.j;
+   Ck = mov.k;
+   op = mov.op;
 
    // realizando a troca
    if(Ci == -1 || Cj == -1)
@@ -380,10 +406,12 @@ int TMutacao::threeOPT(TIndividuo *individuo)
  **/
 int TMutacao::threeOPT2(TIndividuo *individuo)
 {
-	if (individuo->get_extra()) return 0;
    //O 3-opt não pode ser realizado quando existem
    //menos de 6 vértices
    if (individuo->get_qtdeGenes()<6) return 0;
+
+   vector<char> olhar;
+   if (!acordados(individuo, olhar)) return 0;
    
    double gainActual, gainCandidato, diff;
    int Imas1, Jmas1, Kmas1, min, op = -1;
@@ -391,12 +419,20 @@ int TMutacao::threeOPT2(TIndividuo *individuo)
    double valorInicial = individuo->get_distancia();
    int n = individuo->get_qtdeGenes() - 1;
    
-   for(int i = 0; i < n - 4; i++)
+   for(int i = 0; (i < n - 4)&&(!VP_esgotado); i++)
    {
       for(int j = i + 2; j < n - 2; j++)
       {
+         //Os movimentos já aplicados são mantidos
+         if (esgotado(n-j-3)) break;
+
          for(int k = j+2; k < n-1; k++)
          {
+            //Uma das arestas removidas precisa tocar em um gene acordado
+            if (!precisaOlhar(individuo, olhar, i+1) &&
+                !precisaOlhar(individuo, olhar, j+1) &&
+                !precisaOlhar(individuo, olhar, k+1)) continue;
+
 				valor = individuo->get_distancia();
 				min = valor;
 				op = -1;
@@ -505,21 +541,1065 @@ int TMutacao::threeOPT2(TIndividuo *individuo)
 		}
 	}
    
-   individuo->set_extra((valorInicial == individuo->get_distancia())?1:0);
-   return individuo->get_extra()^1;
+   if (VP_esgotado) mantemAcordados(individuo, olhar);
+
+   return (valorInicial == individuo->get_distancia())?0:1;
 }
 
-/*************************
-*  Métodos auxiliares
-*************************/
-double TMutacao::calcValReverso (TGene *g1, TGene *g2)
+/**
+ *
+ * 2-opt com lista de vizinhos e don't look bits
+ *
+ * Bentley (1992). Fast Algorithms for Geometric Traveling Salesman
+ * Problems. ORSA Journal on Computing, 4(4), 387–411.
+ *
+ * Só são testadas as arestas novas que ligam um gene a um de seus
+ * vizinhos candidatos. Os genes ficam em uma fila, um gene sai da fila
+ * quando nenhum movimento a partir dele melhora a rota e só volta
+ * quando uma de suas arestas é alterada (primeira melhora).
+ * A fila começa apenas com os genes cujo don't look bit está limpo e,
+ * ao final, os bits ficam guardados no indivíduo para a próxima geração.
+ *
+ **/
+int TMutacao::twoOPTViz(TIndividuo *individuo)
 {
-	double resultado = 0;
-	for (TGene *aux = g1; aux->id != g2->id; aux = aux->prox)
-	{
-		resultado -= VP_Mapa->get_distancia(aux->ori, aux->prox->dest);
-		resultado += VP_Mapa->get_distancia(aux->prox->ori, aux->dest);
-	}
-	
-	return resultado;
-}
\ No newline at end of file
+   //O 2-opt não pode ser realizado quando existem
+   //menos de 4 vértices
+   if (individuo->get_qtdeGenes()<4) return 0;
+
+   //A inversão no lado mais curto da rota exige custos simétricos
+   if (!individuo->simetrico()) return twoOPT2(individuo);
+
+   double dist = individuo->get_distancia();
+   int n = individuo->get_qtdeGenes();
+
+   TRota rota(VP_Mapa);
+   rota.carrega(individuo);
+   candidatos(individuo);
+
+   //Só entram na fila os genes acordados
+   deque<int> fila;
+   vector<char> naFila (n, 0);
+   for (int p=0; p<n; p++)
+      if (!individuo->get_naoOlhar(rota.get_por_pos(p))) ativa(rota.get_por_pos(p), fila, naFila);
+   if (fila.empty()) return 0;
+
+   int melhorou = 0;
+   while ((!fila.empty())&&(!esgotado(VP_Candidatos->get_k())))
+   {
+      int a = fila.front();
+      fila.pop_front();
+      naFila[a] = 0;
+
+      if (tenta2opt(rota, a, fila, naFila))
+      {
+         melhorou = 1;
+         ativa(a, fila, naFila);
+      }
+   }
+
+   if (melhorou) rota.descarrega(individuo);
+   adormece(individuo, naFila);
+
+   return (dist == individuo->get_distancia())?0:1;
+}
+
+/**
+ *
+ * Or-opt
+ *
+ * Or (1976). Traveling Salesman-Type Combinatorial Problems and Their
+ * Relation to the Logistics of Regional Blood Banking. PhD thesis,
+ * Northwestern University.
+ *
+ * Move segmentos de 1 a 3 genes, nos dois sentidos, para junto de um
+ * vizinho candidato de uma das pontas. Cada movimento é avaliado em O(1).
+ * Utiliza a mesma fila de genes ativos do 2-opt com lista de vizinhos.
+ *
+ **/
+int TMutacao::orOPT(TIndividuo *individuo)
+{
+   //São necessários o segmento, suas 2 pontas e
+   //a aresta de destino fora delas
+   if (individuo->get_qtdeGenes()<8) return 0;
+
+   //A rota em vetor exige custos simétricos
+   if (!individuo->simetrico()) return twoOPT2(individuo);
+
+   double dist = individuo->get_distancia();
+   int n = individuo->get_qtdeGenes();
+
+   TRota rota(VP_Mapa);
+   rota.carrega(individuo);
+   candidatos(individuo);
+
+   //Só entram na fila os genes acordados
+   deque<int> fila;
+   vector<char> naFila (n, 0);
+   for (int p=0; p<n; p++)
+      if (!individuo->get_naoOlhar(rota.get_por_pos(p))) ativa(rota.get_por_pos(p), fila, naFila);
+   if (fila.empty()) return 0;
+
+   int melhorou = 0;
+   while ((!fila.empty())&&(!esgotado(VP_Candidatos->get_k())))
+   {
+      int a = fila.front();
+      fila.pop_front();
+      naFila[a] = 0;
+
+      if (tentaOrOpt(rota, a, fila, naFila))
+      {
+         melhorou = 1;
+         ativa(a, fila, naFila);
+      }
+   }
+
+   if (melhorou) rota.descarrega(individuo);
+   adormece(individuo, naFila);
+
+   return (dist == individuo->get_distancia())?0:1;
+}
+
+/**
+ *
+ * Lin-Kernighan (profundidade variável)
+ *
+ * Lin & Kernighan (1973). An Effective Heuristic Algorithm for the
+ * Traveling-Salesman Problem. Operations Research, 21(2), 498–516.
+ *
+ * Johnson & McGeoch (1997). The Traveling Salesman Problem: A Case Study
+ * in Local Optimization. Local Search in Combinatorial Optimization, 215–310.
+ *
+ * Cada nível é um 2-opt sequencial aplicado na rota em vetor. No primeiro
+ * nível todos os vizinhos candidatos são tentados, nos seguintes apenas o
+ * de maior ganho, até VP_profundidadeLK níveis. Os níveis além do melhor
+ * ganho encontrado são desfeitos.
+ *
+ **/
+int TMutacao::LK(TIndividuo *individuo)
+{
+   if (individuo->get_qtdeGenes()<8) return 0;
+
+   //A rota em vetor exige custos simétricos
+   if (!individuo->simetrico()) return twoOPT2(individuo);
+
+   double dist = individuo->get_distancia();
+   int n = individuo->get_qtdeGenes();
+
+   TRota rota(VP_Mapa);
+   rota.carrega(individuo);
+   candidatos(individuo);
+
+   //Só entram na fila os genes acordados
+   deque<int> fila;
+   vector<char> naFila (n, 0);
+   for (int p=0; p<n; p++)
+      if (!individuo->get_naoOlhar(rota.get_por_pos(p))) ativa(rota.get_por_pos(p), fila, naFila);
+   if (fila.empty()) return 0;
+
+   int melhorou = 0;
+   while ((!fila.empty())&&(!esgotado(VP_Candidatos->get_k())))
+   {
+      int a = fila.front();
+      fila.pop_front();
+      naFila[a] = 0;
+
+      if (tentaLK(rota, a, fila, naFila))
+      {
+         melhorou = 1;
+         ativa(a, fila, naFila);
+      }
+   }
+
+   if (melhorou) rota.descarrega(individuo);
+   adormece(individuo, naFila);
+
+   return (dist == individuo->get_distancia())?0:1;
+}
+
+/**
+ *
+ * Or-3opt (inserção de segmento) com lista de vizinhos
+ *
+ * Bentley (1992). Fast Algorithms for Geometric Traveling Salesman
+ * Problems. ORSA Journal on Computing, 4(4), 387–411.
+ *
+ * 3-opt puro, sem inversão: as arestas (t1,t2), (t3,t4) e (t5,t6) são
+ * trocadas por (t2,t3), (t4,t5) e (t6,t1), o que equivale a trocar de
+ * lugar os segmentos t2..t5 e t6..t3, de qualquer tamanho. As arestas
+ * (t2,t3) e (t4,t5) vêm das listas de candidatos e cada movimento é
+ * avaliado em O(1), ao contrário do sorteio de k do threeOPT.
+ *
+ **/
+int TMutacao::threeOPTViz(TIndividuo *individuo)
+{
+   //O 3-opt não pode ser realizado quando existem
+   //menos de 6 vértices
+   if (individuo->get_qtdeGenes()<6) return 0;
+
+   //A rota em vetor exige custos simétricos
+   if (!individuo->simetrico()) return threeOPT2(individuo);
+
+   double dist = individuo->get_distancia();
+   int n = individuo->get_qtdeGenes();
+
+   TRota rota(VP_Mapa);
+   rota.carrega(individuo);
+   candidatos(individuo);
+
+   //Só entram na fila os genes acordados
+   deque<int> fila;
+   vector<char> naFila (n, 0);
+   for (int p=0; p<n; p++)
+      if (!individuo->get_naoOlhar(rota.get_por_pos(p))) ativa(rota.get_por_pos(p), fila, naFila);
+   if (fila.empty()) return 0;
+
+   int melhorou = 0;
+   while ((!fila.empty())&&(!esgotado(VP_Candidatos->get_k())))
+   {
+      int a = fila.front();
+      fila.pop_front();
+      naFila[a] = 0;
+
+      if (tentaOr3opt(rota, a, fila, naFila))
+      {
+         melhorou = 1;
+         ativa(a, fila, naFila);
+      }
+   }
+
+   if (melhorou) rota.descarrega(individuo);
+   adormece(individuo, naFila);
+
+   return (dist == individuo->get_distancia())?0:1;
+}
+
+/**
+ *
+ * Escolha adaptativa do operador (multi-armed bandit, UCB1)
+ *
+ * Auer, Cesa-Bianchi & Fischer (2002). Finite-time Analysis of the
+ * Multiarmed Bandit Problem. Machine Learning, 47, 235–256.
+ *
+ * Fialho, Da Costa, Schoenauer & Sebag (2010). Analyzing bandit-based
+ * adaptive operator selection mechanisms. Annals of Mathematics and
+ * Artificial Intelligence, 60, 25–64.
+ *
+ * A recompensa é a redução da distância por microssegundo gasto. Cada
+ * operador é tentado uma vez e depois escolhe-se o de maior média
+ * normalizada mais o termo de exploração. O 3-opt, o 2-opt(2) e o
+ * 3-opt(2) ficam de fora, uma única chamada deles pode custar mais do
+ * que a geração. O 3-opt é representado pelo or-3opt. Nos indivíduos
+ * não simétricos (os reduzidos da recursividade) o 2-opt e as buscas
+ * com lista de candidatos (7 a 10) caem em varreduras completas, que
+ * continuam concorrendo: ficam limitadas por maxAvaliacoes e
+ * maxTempoMutacao e a recompensa por microssegundo as penaliza.
+ *
+ **/
+int TMutacao::adaptativa(TIndividuo *individuo)
+{
+   static const int tipos[] = {0, 1, 2, 4, 7, 8, 9, 10};
+
+   if (VP_bracos.empty())
+   {
+      for (int t : tipos)
+      {
+         TBraco b = {t, 0, 0, 0, 0, 0};
+         VP_bracos.push_back(b);
+      }
+   }
+
+   //Operadores ainda não utilizados primeiro
+   int escolha = -1;
+   double maxMedia = 0;
+   for (int b=0; b<(int)VP_bracos.size(); b++)
+   {
+      if ((!VP_bracos[b].usos)&&(escolha==-1)) escolha = b;
+      if (VP_bracos[b].media>maxMedia) maxMedia = VP_bracos[b].media;
+   }
+
+   if (escolha==-1)
+   {
+      double melhor = -1;
+      for (int b=0; b<(int)VP_bracos.size(); b++)
+      {
+            double v = sqrt(2.0*log((double)VP_usosTotal)/VP_bracos[b].usos);
+         if (maxMedia>0) v += VP_bracos[b].media/maxMedia;
+         if (v>melhor)
+         {
+            melhor = v;
+            escolha = b;
+         }
+      }
+   }
+
+   TBraco &braco = VP_bracos[escolha];
+   double antes = individuo->get_distancia();
+
+   chrono::steady_clock::time_point ini = chrono::steady_clock::now();
+   int resultado = executa(braco.tipo, individuo);
+   double us = chrono::duration<double, micro>(chrono::steady_clock::now() - ini).count();
+
+   double ganho = antes - individuo->get_distancia();
+   if (ganho<0) ganho = 0;
+
+   braco.usos++;
+   if (ganho>0) braco.melhoras++;
+   braco.ganho += ganho;
+   braco.tempo += us;
+   braco.media += taxaRecompensa*(ganho/((us>1)?us:1) - braco.media);
+   VP_usosTotal++;
+
+   return resultado;
+}
+
+void TMutacao::registraEstatisticas ()
+{
+   if ((!VP_ArqSaida)||(VP_bracos.empty())) return;
+
+   VP_ArqSaida->addLinha("Mutação adaptativa;Tipo;Usos;Melhoras;Ganho;Tempo (us);Recompensa");
+   for (int b=0; b<(int)VP_bracos.size(); b++)
+   {
+      string lin = ";";
+      lin += to_string(VP_bracos[b].tipo);
+      lin += ";";
+      lin += to_string(VP_bracos[b].usos);
+      lin += ";";
+      lin += to_string(VP_bracos[b].melhoras);
+      lin += ";";
+      lin += to_string(VP_bracos[b].ganho);
+      lin += ";";
+      lin += to_string(VP_bracos[b].tempo);
+      lin += ";";
+      lin += to_string(VP_bracos[b].media);
+      VP_ArqSaida->addLinha(lin);
+   }
+}
+
+/**
+ *
+ * Busca local iterada (ILS) com double-bridge local
+ *
+ * Martin, Otto & Felten (1991). Large-Step Markov Chains for the
+ * Traveling Salesman Problem. Complex Systems, 5(3), 299–326.
+ *
+ * Lourenço, Martin & Stützle (2003). Iterated Local Search. In Glover &
+ * Kochenberger (eds.) Handbook of Metaheuristics, 321–353.
+ *
+ * O chute transforma A B C D E em A D C B E, com B, C e D dentro de uma
+ * janela de tamJanelaILS genes, alterando 4 arestas. Só os 8 genes
+ * dessas arestas entram na fila do 2-opt e do Or-opt com lista de
+ * vizinhos. O resultado é aceito se for melhor, senão as inversões
+ * registradas desde o chute são desfeitas, sem copiar a rota inteira.
+ *
+ **/
+int TMutacao::ILS(TIndividuo *individuo)
+{
+   if (individuo->get_qtdeGenes()<8) return 0;
+
+   //A rota em vetor exige custos simétricos
+   if (!individuo->simetrico()) return twoOPT2(individuo);
+
+   double dist = individuo->get_distancia();
+   int n = individuo->get_qtdeGenes();
+   int janela = (tamJanelaILS<n)?tamJanelaILS:n-1;
+
+   TRota rota(VP_Mapa);
+   rota.carrega(individuo);
+   candidatos(individuo);
+
+   deque<int> fila;
+   vector<char> naFila (n, 0);
+   int melhorou = 0;
+
+   for (int it=0; (it<chutesILS)&&(!esgotado(1)); it++)
+   {
+      //Cortes x < y < z < w a partir do gene na posição s
+      int c[4];
+      for (int q=0; q<4; q++)
+      {
+         bool repetido;
+         do
+         {
+            c[q] = TUtils::rnd(1, janela);
+            repetido = false;
+            for (int r=0; r<q; r++) if (c[r]==c[q]) repetido = true;
+         } while (repetido);
+      }
+      sort(c, c+4);
+
+      int s = TUtils::rnd(0, n-1);
+      int a  = rota.get_por_pos((s+c[0]-1)%n);
+      int b1 = rota.get_por_pos((s+c[0])%n);
+      int bL = rota.get_por_pos((s+c[1]-1)%n);
+      int c1 = rota.get_por_pos((s+c[1])%n);
+      int cL = rota.get_por_pos((s+c[2]-1)%n);
+      int d1 = rota.get_por_pos((s+c[2])%n);
+      int dL = rota.get_por_pos((s+c[3]-1)%n);
+      int e  = rota.get_por_pos((s+c[3])%n);
+
+      double chute = rota.dist(a, d1) + rota.dist(dL, c1) + rota.dist(cL, b1) + rota.dist(bL, e)
+                   - rota.dist(a, b1) - rota.dist(bL, c1) - rota.dist(cL, d1) - rota.dist(dL, e);
+
+      rota.marca();
+
+      //Só com 2-opt, que não depende do sentido atual do vetor:
+      //A B C D E  =>  A D'C'B' E  =>  A D C'B' E  =>  A D C B'E  =>  A D C B E
+      rota.move2opt(a, b1, dL, e);
+      rota.move2opt(a, dL, d1, cL);
+      rota.move2opt(dL, cL, c1, bL);
+      rota.move2opt(cL, bL, b1, e);
+
+      int tocados[8] = {a, b1, bL, c1, cL, d1, dL, e};
+      for (int q=0; q<8; q++) ativa(tocados[q], fila, naFila);
+
+      VP_ganho = 0;
+      while (!fila.empty())
+      {
+         int g = fila.front();
+         fila.pop_front();
+         naFila[g] = 0;
+
+         if (tenta2opt(rota, g, fila, naFila) || tentaOrOpt(rota, g, fila, naFila))
+            ativa(g, fila, naFila);
+      }
+
+      if (chute-VP_ganho < -1e-7) melhorou = 1;
+      else rota.volta();
+   }
+
+   if (!melhorou) return 0;
+
+   //Os don't look bits só são mantidos nos genes com os mesmos vizinhos
+   vector<int> vizAnt (2*n);
+   vector<char> bits (n);
+   for (int id=0; id<n; id++)
+   {
+      vizAnt[2*id]   = individuo->get_por_id(id)->ant->id;
+      vizAnt[2*id+1] = individuo->get_por_id(id)->prox->id;
+      bits[id] = individuo->get_naoOlhar(id);
+   }
+
+   rota.descarrega(individuo);
+
+   for (int id=0; id<n; id++)
+   {
+      int x = individuo->get_por_id(id)->ant->id;
+      int y = individuo->get_por_id(id)->prox->id;
+      if (((x==vizAnt[2*id])&&(y==vizAnt[2*id+1]))||((x==vizAnt[2*id+1])&&(y==vizAnt[2*id])))
+         individuo->set_naoOlhar(id, bits[id]);
+   }
+
+   return (dist == individuo->get_distancia())?0:1;
+}
+
+/**
+ *
+ * Simulated annealing
+ *
+ * Kirkpatrick, Gelatt & Vecchi (1983). Optimization by Simulated
+ * Annealing. Science, 220(4598), 671–680.
+ *
+ * Cada proposta é uma troca, inversão ou inserção sorteada, avaliada
+ * pelos get_delta do indivíduo sem alterá-lo. Só as propostas aceitas
+ * refazem o encadeamento. A temperatura inicial é VP_temperaturaSA ou,
+ * quando 0, 10% do custo médio das arestas do indivíduo, e é
+ * multiplicada por VP_resfriamentoSA/10000 a cada proposta. Ao final
+ * o indivíduo volta ao melhor estado visto, desfazendo as propostas
+ * aceitas depois dele.
+ *
+ **/
+int TMutacao::SA(TIndividuo *individuo)
+{
+   int n = individuo->get_qtdeGenes();
+   if (n<4) return 0;
+
+   double dist = individuo->get_distancia();
+   double temperatura = (VP_temperaturaSA>0)?VP_temperaturaSA:0.1*dist/n;
+   double resfriamento = VP_resfriamentoSA/10000.0;
+
+   //Propostas aceitas depois do melhor estado visto, para desfazer
+   double melhorDist = dist;
+   vector<int> desfaz;
+
+   for (int it=0; (it<VP_iteracoesSA)&&(!esgotado(1)); it++)
+   {
+      int i = TUtils::rnd(1, n-1);
+      int j = TUtils::rnd(1, n-1);
+      if (i==j) continue;
+
+      int op = TUtils::rnd(0, 2);
+      double delta;
+      if (op==0) delta = individuo->get_delta_troca(i, j);
+      else if (op==1) delta = individuo->get_delta_inversao(i, j);
+      else delta = individuo->get_delta_insercao(i, j);
+
+      if ((delta<=0)||((temperatura>0)&&(TUtils::rndDouble()<exp(-delta/temperatura))))
+      {
+         if (op==0) individuo->troca_indice(i, j);
+         else if (op==1) individuo->inverte_sub_indice(i, j);
+         else individuo->insere_indice(i, j);
+
+         desfaz.push_back(op);
+         desfaz.push_back(i);
+         desfaz.push_back(j);
+         if (individuo->get_distancia()<=melhorDist)
+         {
+            melhorDist = individuo->get_distancia();
+            desfaz.clear();
+         }
+      }
+
+      temperatura *= resfriamento;
+   }
+
+   //Troca e inversão são a própria inversa, a inserção de i em j é
+   //desfeita pela inserção de j em i
+   for (int k=desfaz.size()-3; k>=0; k-=3)
+   {
+      int op = desfaz[k], i = desfaz[k+1], j = desfaz[k+2];
+      if (op==0) individuo->troca_indice(i, j);
+      else if (op==1) individuo->inverte_sub_indice(i, j);
+      else individuo->insere_indice(j, i);
+   }
+
+   return (dist == individuo->get_distancia())?0:1;
+}
+
+/*************************
+*  Métodos auxiliares
+*************************/
+double TMutacao::calcValReverso (TGene *g1, TGene *g2)
+{
+	double resultado = 0;
+	for (TGene *aux = g1; aux->id != g2->id; aux = aux->prox)
+	{
+		resultado -= VP_Mapa->get_distancia(aux->ori, aux->prox->dest);
+		resultado += VP_Mapa->get_distancia(aux->prox->ori, aux->dest);
+	}
+	
+	return resultado;
+}
+
+//Guarda em olhar os genes acordados e marca todos os don't look bits.
+//As alterações feitas durante a busca voltam a limpar os bits das
+//pontas das arestas alteradas. Retorna a quantidade de genes acordados
+int TMutacao::acordados (TIndividuo *individuo, vector<char> &olhar)
+{
+   int n = individuo->get_qtdeGenes();
+   int qtde = 0;
+
+   olhar.resize(n);
+   for (int id=0; id<n; id++)
+   {
+      olhar[id] = individuo->get_naoOlhar(id)^1;
+      qtde += olhar[id];
+   }
+
+   if (qtde) individuo->set_extra(1);
+   return qtde;
+}
+
+//Se algum gene da aresta que chega no índice estava acordado no início
+//da busca ou teve uma aresta alterada durante a busca
+bool TMutacao::precisaOlhar (TIndividuo *individuo, vector<char> &olhar, int indice)
+{
+   int a = individuo->get_por_indice(indice)->id;
+   int b = individuo->get_por_indice(individuo->ind_ant(indice))->id;
+
+   return olhar[a] || olhar[b] || !individuo->get_naoOlhar(a) || !individuo->get_naoOlhar(b);
+}
+
+//Os genes que saíram da fila sem melhora não precisam ser olhados
+void TMutacao::adormece (TIndividuo *individuo, vector<char> &naFila)
+{
+   for (int id=0; id<individuo->get_qtdeGenes(); id++)
+      individuo->set_naoOlhar(id, naFila[id]^1);
+}
+
+//Na saída antecipada não é possível saber quais genes já foram
+//olhados, os que estavam acordados no início continuam acordados
+void TMutacao::mantemAcordados (TIndividuo *individuo, vector<char> &olhar)
+{
+   for (int id=0; id<individuo->get_qtdeGenes(); id++)
+      if (olhar[id]) individuo->set_naoOlhar(id, 0);
+}
+
+TListaCandidatos *TMutacao::candidatos (TIndividuo *individuo)
+{
+   if (!VP_Candidatos) VP_Candidatos = new TListaCandidatos(VP_Mapa);
+
+   if (!VP_Candidatos->mesmosGenes(individuo))
+      VP_Candidatos->monta(individuo, VP_numCandidatos);
+
+   return VP_Candidatos;
+}
+
+void TMutacao::ativa (int g, deque<int> &fila, vector<char> &naFila)
+{
+   if (naFila[g]) return;
+   naFila[g] = 1;
+   fila.push_back(g);
+}
+
+//Procura, a partir do gene a, um 2-opt que melhore a rota e o aplica.
+//Considera as duas arestas de a, (a, prox a) e (ant a, a)
+int TMutacao::tenta2opt (TRota &rota, int a, deque<int> &fila, vector<char> &naFila)
+{
+   int *viz = VP_Candidatos->vizinhos(a);
+   int k = VP_Candidatos->get_k();
+
+   for (int sentido=0; sentido<2; sentido++)
+   {
+      int a2 = (sentido==0)?rota.prox(a):rota.ant(a);
+      double d1 = rota.dist(a, a2);
+
+      for (int v=0; v<k; v++)
+      {
+         int c = viz[v];
+         double ganho1 = d1 - rota.dist(a, c);
+
+         //Os vizinhos estão ordenados, os próximos não terão ganho
+         if (ganho1<=0) break;
+
+         int c2 = (sentido==0)?rota.prox(c):rota.ant(c);
+         if ((c==a2)||(c2==a)) continue;
+
+         double ganho = ganho1 + rota.dist(c, c2) - rota.dist(a2, c2);
+         if (ganho>1e-7)
+         {
+            VP_ganho += ganho;
+
+            //Remove (a,a2) e (c,c2), inclui (a,c) e (a2,c2)
+            if (sentido==0) rota.inverte(a2, c);
+            else rota.inverte(a, c2);
+
+            ativa(a2, fila, naFila);
+            ativa(c, fila, naFila);
+            ativa(c2, fila, naFila);
+            return 1;
+         }
+      }
+   }
+
+   return 0;
+}
+
+//Procura um Or-opt para um segmento que tem o gene a em uma das pontas
+int TMutacao::tentaOrOpt (TRota &rota, int a, deque<int> &fila, vector<char> &naFila)
+{
+   int k = VP_Candidatos->get_k();
+
+   for (int tam=1; tam<=3; tam++)
+   {
+      //Segmento a partir de a, para frente e para trás
+      for (int sentido=0; sentido<((tam==1)?1:2); sentido++)
+      {
+         int s1 = a;
+         int sL = a;
+         for (int t=1; t<tam; t++)
+         {
+            if (sentido==0) sL = rota.prox(sL);
+            else s1 = rota.ant(s1);
+         }
+
+         int p = rota.ant(s1);
+         int q = rota.prox(sL);
+         if ((p==sL)||(q==s1)||(p==q)) continue;
+
+         //Ganho em retirar o segmento
+         double ganhoRetira = rota.dist(p, s1) + rota.dist(sL, q) - rota.dist(p, q);
+         if (ganhoRetira<=1e-7) continue;
+
+         for (int ponta=0; ponta<2; ponta++)
+         {
+            int e = (ponta==0)?s1:sL;
+            int *viz = VP_Candidatos->vizinhos(e);
+
+            for (int v=0; v<k; v++)
+            {
+               int c = viz[v];
+               if (rota.dist(e, c)>=ganhoRetira) break;
+               if (rota.entre(s1, c, sL)) continue;
+
+               //Aresta de destino antes ou depois do vizinho
+               for (int lado=0; lado<2; lado++)
+               {
+                  int x = (lado==0)?c:rota.ant(c);
+                  int y = rota.prox(x);
+                  if (rota.entre(s1, x, sL)||rota.entre(s1, y, sL)) continue;
+
+                  double dxy = rota.dist(x, y);
+                  double direto = rota.dist(x, s1) + rota.dist(sL, y) - dxy;
+                  double invertido = rota.dist(x, sL) + rota.dist(s1, y) - dxy;
+                  bool inv = (invertido<direto);
+                  double ganho = ganhoRetira - (inv?invertido:direto);
+
+                  if (ganho>1e-7)
+                  {
+                     VP_ganho += ganho;
+                     rota.moveSegmento(s1, sL, x, y, inv);
+
+                     ativa(p, fila, naFila);
+                     ativa(q, fila, naFila);
+                     ativa(x, fila, naFila);
+                     ativa(y, fila, naFila);
+                     ativa(s1, fila, naFila);
+                     ativa(sL, fila, naFila);
+                     return 1;
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   return 0;
+}
+
+//Procura, a partir de t1, uma troca de segmentos t2..t5 <-> t6..t3 que
+//melhore a rota e a aplica. No sentido 1 a rota é percorrida de trás
+//para frente, t2 é o antecessor de t1 e assim por diante
+int TMutacao::tentaOr3opt (TRota &rota, int t1, deque<int> &fila, vector<char> &naFila)
+{
+   int k = VP_Candidatos->get_k();
+
+   for (int sentido=0; sentido<2; sentido++)
+   {
+      int t2 = (sentido==0)?rota.prox(t1):rota.ant(t1);
+      double d12 = rota.dist(t1, t2);
+      int *viz2 = VP_Candidatos->vizinhos(t2);
+
+      for (int v=0; v<k; v++)
+      {
+         int t3 = viz2[v];
+         double g1 = d12 - rota.dist(t2, t3);
+         if (g1<=1e-7) break;
+         if (t3==t1) continue;
+
+         int t4 = (sentido==0)?rota.prox(t3):rota.ant(t3);
+         if (t4==t1) continue;
+
+         double d34 = rota.dist(t3, t4);
+         int *viz4 = VP_Candidatos->vizinhos(t4);
+
+         for (int w=0; w<k; w++)
+         {
+            int t5 = viz4[w];
+            double g2 = g1 + d34 - rota.dist(t4, t5);
+            if (g2<=1e-7) break;
+
+            //t5 precisa estar entre t2 e t3 (sem o t3) para a rota fechar
+            if (t5==t3) continue;
+            if ((sentido==0)?!rota.entre(t2, t5, t3):!rota.entre(t3, t5, t2)) continue;
+
+            int t6 = (sentido==0)?rota.prox(t5):rota.ant(t5);
+            double ganho = g2 + rota.dist(t5, t6) - rota.dist(t6, t1);
+            if (ganho<=1e-7) continue;
+            VP_ganho += ganho;
+
+            //t1 t6..t3 t2..t5 t4
+            if (sentido==0) rota.moveSegmento(t2, t5, t3, t4, false);
+            else rota.moveSegmento(t5, t2, t4, t3, false);
+
+            ativa(t1, fila, naFila);
+            ativa(t2, fila, naFila);
+            ativa(t3, fila, naFila);
+            ativa(t4, fila, naFila);
+            ativa(t5, fila, naFila);
+            ativa(t6, fila, naFila);
+            return 1;
+         }
+      }
+   }
+
+   return 0;
+}
+
+//Cadeia de 2-opts sequenciais a partir de t1. Em cada nível a aresta
+//(t1,t2) é retirada, (t2,t3) incluída, (t3,t4) retirada e (t4,t1) fecha
+//a rota. O t4 passa a ser o t2 do próximo nível.
+int TMutacao::tentaLK (TRota &rota, int t1, deque<int> &fila, vector<char> &naFila)
+{
+   int k = VP_Candidatos->get_k();
+   int prof = (VP_profundidadeLK>0)?VP_profundidadeLK:1;
+   vector<int> passos (4*prof);
+
+   for (int sentido=0; sentido<2; sentido++)
+   {
+      int t2Ini = (sentido==0)?rota.prox(t1):rota.ant(t1);
+      int *vizIni = VP_Candidatos->vizinhos(t2Ini);
+
+      for (int v=0; v<k; v++)
+      {
+         if (rota.dist(t1, t2Ini)<=rota.dist(t2Ini, vizIni[v])) break;
+
+         int t2 = t2Ini;
+         //ganho acumulado sem a aresta de fechamento
+         double g = rota.dist(t1, t2);
+         double melhorGanho = 0;
+         int melhorNivel = 0;
+         int nivel = 0;
+
+         while (nivel<prof)
+         {
+            int *viz = VP_Candidatos->vizinhos(t2);
+            int t3Esc = -1;
+            int t4Esc = -1;
+            double melhorCrit = -1;
+
+            //No primeiro nível o t3 é o v-ésimo candidato
+            int ini = (nivel==0)?v:0;
+            int fim = (nivel==0)?v+1:k;
+            for (int j=ini; j<fim; j++)
+            {
+               int t3 = viz[j];
+               double g1 = g - rota.dist(t2, t3);
+               if (g1<=0) break;
+               if ((t3==t1)||(t3==rota.prox(t2))||(t3==rota.ant(t2))) continue;
+
+               int t4 = (rota.prox(t1)==t2)?rota.ant(t3):rota.prox(t3);
+               if ((t4==t2)||(t4==t1)) continue;
+
+               //Não retira uma aresta incluída nesta cadeia
+               bool incluida = false;
+               for (int p=0; p<nivel; p++)
+               {
+                  int a = passos[4*p+1];
+                  int b = passos[4*p+2];
+                  if (((a==t3)&&(b==t4))||((a==t4)&&(b==t3))) incluida = true;
+               }
+               if (incluida) continue;
+
+               double crit = g1 + rota.dist(t3, t4);
+               if (crit>melhorCrit)
+               {
+                  melhorCrit = crit;
+                  t3Esc = t3;
+                  t4Esc = t4;
+               }
+            }
+
+            if (t3Esc<0) break;
+
+            //t1 t2 .. t4 t3  =>  t1 t4 .. t2 t3
+            rota.move2opt(t1, t2, t4Esc, t3Esc);
+            passos[4*nivel]   = t1;
+            passos[4*nivel+1] = t2;
+            passos[4*nivel+2] = t3Esc;
+            passos[4*nivel+3] = t4Esc;
+            nivel++;
+
+            g = melhorCrit;
+            double ganho = g - rota.dist(t4Esc, t1);
+            if (ganho>melhorGanho+1e-7)
+            {
+               melhorGanho = ganho;
+               melhorNivel = nivel;
+            }
+            t2 = t4Esc;
+         }
+
+         //Desfaz os níveis além do melhor
+         for (int p=nivel-1; p>=melhorNivel; p--)
+            rota.move2opt(passos[4*p], passos[4*p+3], passos[4*p+1], passos[4*p+2]);
+
+         if (melhorNivel>0)
+         {
+            VP_ganho += melhorGanho;
+            for (int p=0; p<melhorNivel; p++)
+               for (int q=0; q<4; q++) ativa(passos[4*p+q], fila, naFila);
+            return 1;
+         }
+      }
+   }
+
+   return 0;
+}
+
+//Linhas i = t, t+numThreads, ... do 3-opt. Guarda em m o melhor movimento
+void TMutacao::varre3opt (TIndividuo *individuo, unsigned semente, int t, int numThreads, TMovimento &m)
+{
+   double gainActual, gainCandidato, diff;
+   int Imas1, Jmas1, Kmas1;
+   double valor = individuo->get_distancia();
+   int n = individuo->get_qtdeGenes() - 1;
+   minstd_rand gerador (semente);
+
+   for(int i = t; i < n - 4; i += numThreads)
+   {
+      for(int j = i + 2; j < n - 2; j++)
+      {
+         //Fica o melhor movimento encontrado até aqui
+         if (esgotado(10)) return;
+
+         for(int K = 0; K < 10; K++)
+         {
+            int k = gerador() % (n-1-(j+2)+1) + j+2;
+
+            Imas1 = i + 1;
+            Jmas1 = j + 1;
+            Kmas1 = k + 1;
+
+            TGene *gi = individuo->get_por_indice(i);
+            TGene *gj = individuo->get_por_indice(j);
+            TGene *gk = individuo->get_por_indice(k);
+
+            TGene *gImas1 = individuo->get_por_indice(Imas1);
+            TGene *gJmas1 = individuo->get_por_indice(Jmas1);
+            TGene *gKmas1 = individuo->get_por_indice(Kmas1);
+
+            //operação 1
+            gainActual = VP_Mapa->get_distancia(gi->ori, gImas1->dest) +
+                         VP_Mapa->get_distancia(gj->ori, gJmas1->dest) +
+                         VP_Mapa->get_distancia(gk->ori, gKmas1->dest);
+
+            gainCandidato = VP_Mapa->get_distancia(gi->ori, gj->dest) +
+                            VP_Mapa->get_distancia(gImas1->ori, gk->dest) +
+                            VP_Mapa->get_distancia(gJmas1->ori, gKmas1->dest);
+
+            diff = valor - gainActual + gainCandidato + 
+				       this->calcValReverso(gImas1, gj) +
+				       this->calcValReverso(gJmas1, gk);
+
+            if(m.valor > diff)
+            {
+               m.op = 0;
+               m.i = i;
+               m.j = j;
+               m.k = k;
+               m.valor = diff;
+            }
+
+            //operação 2
+            gainCandidato = VP_Mapa->get_distancia(gi->ori, gJmas1->dest) +
+                            VP_Mapa->get_distancia(gk->ori, gImas1->dest) +
+                            VP_Mapa->get_distancia(gj->ori, gKmas1->dest);
+
+            diff = valor - gainActual + gainCandidato;
+
+            if(m.valor > diff)
+            {
+               m.op = 1;
+               m.i = i;
+               m.j = j;
+               m.k = k;
+               m.valor = diff;
+            }
+
+            //operação 3
+            gainCandidato = VP_Mapa->get_distancia(gi->ori, gk->dest) +
+                            VP_Mapa->get_distancia(gJmas1->ori, gImas1->dest) +
+                            VP_Mapa->get_distancia(gj->ori, gKmas1->dest);
+
+            diff = valor - gainActual + gainCandidato +
+                   this->calcValReverso(gJmas1, gk);
+
+            if(m.valor > diff)
+            {
+               m.op = 2;
+               m.i = i;
+               m.j = j;
+               m.k = k;
+               m.valor = diff;
+            }
+
+            //operação 4
+            gainCandidato = VP_Mapa->get_distancia(gi->ori, gJmas1->dest) +
+                            VP_Mapa->get_distancia(gk->ori, gj->dest) +
+                            VP_Mapa->get_distancia(gImas1->ori, gKmas1->dest);
+
+            diff = valor - gainActual + gainCandidato +
+				       this->calcValReverso(gImas1, gj);
+
+            if(m.valor > diff)
+            {
+               m.op = 3;
+               m.i = i;
+               m.j = j;
+               m.k = k;
+               m.valor = diff;
+            }
+         }
+      }
+   }
+}
+
+//Linhas i = t, t+numThreads, ... do 2-opt. Guarda em m o melhor movimento
+void TMutacao::varre2opt (TIndividuo *individuo, int t, int numThreads, TMovimento &m)
+{
+   double diff;
+
+   for(int i = 1+t; i < individuo->get_qtdeGenes(); i += numThreads)
+   {
+      //Fica o melhor movimento encontrado até aqui
+      if (esgotado(individuo->get_qtdeGenes()-i-4)) break;
+
+      for(int j = i + 2; j < individuo->get_qtdeGenes() - 2; j++)
+      {
+         diff = individuo->get_dist_sub_reverso_indice(i, j);
+
+         if(diff < m.valor)
+         {
+            m.valor = diff;
+            m.i = i;
+            m.j = j;
+         }
+      }
+   }
+}
+
+//Mesma varredura do varre2opt para indivíduos simétricos, com a
+//variação de cada linha i calculada de forma vetorizada
+void TMutacao::varre2optVetor (vector<int> &c, vector<double> &e, double dist, int t, int numThreads, TMovimento &m)
+{
+   int n = c.size();
+   double *matriz = VP_Mapa->get_matriz();
+   int qtdeMapa = VP_Mapa->get_qtdeGenes();
+
+   for(int i = 1+t; i < n; i += numThreads)
+   {
+      if (esgotado(n-i-4)) break;
+
+      const double *linhaA = matriz + (size_t)c[i-1]*qtdeMapa;
+      const double *linhaB = matriz + (size_t)c[i]*qtdeMapa;
+
+      //A variação precisa ser menor do que a do melhor até agora
+      double delta = m.valor - dist;
+      int j = TDelta2opt::melhorJ(linhaA, linhaB, &c[0], &e[0], linhaA[c[i]], i+2, n-2, delta);
+
+      if (j>=0)
+      {
+         m.valor = dist + delta;
+         m.i = i;
+         m.j = j;
+      }
+   }
+}
+
+//Executa a varredura em numThreads partes e reduz para o melhor movimento.
+//Em caso de empate vale o primeiro na ordem (i, j, k) da varredura serial
+void TMutacao::paralelo (int qtdeGenes, TMovimento &melhor, function<void(int, int, TMovimento &)> varredura)
+{
+   int numThreads = VP_numThreads;
+   if (numThreads<=0) numThreads = thread::hardware_concurrency();
+   if ((numThreads<=0)||(qtdeGenes<minGenesThreads)) numThreads = 1;
+
+   vector<TMovimento> parcial (numThreads, melhor);
+   vector<thread> threads;
+
+   for (int t=1; t<numThreads; t++)
+      threads.push_back(thread(varredura, t, numThreads, ref(parcial[t])));
+   varredura(0, numThreads, parcial[0]);
+   for (unsigned t=0; t<threads.size(); t++) threads[t].join();
+
+   for (int t=0; t<numThreads; t++)
+   {
+      TMovimento &m = parcial[t];
+      if (m.i==-1) continue;
+
+      if ((melhor.i==-1)||(m.valor<melhor.valor)||
+          ((m.valor==melhor.valor)&&((m.i<melhor.i)||((m.i==melhor.i)&&(m.j<melhor.j)))))
+         melhor = m;
+   }
+}
@@ -18,6 +18,49 @@
 #include "utils.hpp"
 #include "tsp.hpp"
 #include "arqlog.hpp"
+#include "candidatos.hpp"
+#include "rota.hpp"
+#include "delta2opt.hpp"
+#include <deque>
+#include <thread>
+#include <functional>
+#include <atomic>
+
+//Abaixo desta quantidade de genes a varredura do 2-opt e do 3-opt
+//não compensa o custo de criar as threads
+const int minGenesThreads = 200;
+
+//Tipo de mutação que escolhe o operador a cada chamada (UCB)
+const int mutacaoAdaptativa = 11;
+//Peso da última recompensa na média de cada operador. As médias
+//acompanham a fase da execução em vez de acumular desde o início
+const double taxaRecompensa = 0.1;
+
+//Estatísticas de um operador na escolha adaptativa
+struct TBraco
+{
+   int tipo;
+   long usos;
+   long melhoras;
+   double ganho;    //soma das reduções de distância
+   double tempo;    //microssegundos
+   double media;    //média móvel da recompensa (ganho por microssegundo)
+};
+
+//Chutes por chamada da busca local iterada e tamanho da janela
+//onde ficam os 3 segmentos do double-bridge
+const int chutesILS = 20;
+const int tamJanelaILS = 50;
+
+//Melhor movimento encontrado em uma varredura
+struct TMovimento
+{
+   double valor;   //distância total após o movimento
+   int i;
+   int j;
+   int k;
+   int op;
+};
 
 class TMutacao
 {
@@ -26,6 +69,30 @@ class TMutacao
       TArqLog *VP_ArqSaida;
 
       int VP_mutacao;
+      int VP_numCandidatos;
+      int VP_profundidadeLK;
+      int VP_numThreads;
+      int VP_temperaturaSA;
+      int VP_resfriamentoSA;
+      int VP_iteracoesSA;
+
+      //Orçamento de cada chamada (0 = sem limite). As varreduras
+      //paralelas somam as avaliações no mesmo contador
+      int VP_maxAvaliacoes;
+      int VP_maxTempo;
+      atomic<long> VP_avaliacoes;
+      atomic<bool> VP_esgotado;
+      chrono::steady_clock::time_point VP_inicio;
+
+      //Lista de vizinhos, montada na primeira busca local
+      //e refeita apenas quando o conjunto de genes muda
+      TListaCandidatos *VP_Candidatos;
+      //Soma dos ganhos dos movimentos aplicados pelas buscas com fila
+      double VP_ganho;
+
+      //Escolha adaptativa
+      vector<TBraco> VP_bracos;
+      long VP_usosTotal;
    public:
 
       //Apenas leitura
@@ -34,9 +101,34 @@ class TMutacao
 
 
       TMutacao (TMapaGenes *mapa, TArqLog *arqSaida, int tipoMutacao);
+      ~TMutacao ();
       int processa (TIndividuo *individuo);
 
+      //Grava no log as estatísticas da escolha adaptativa
+      void registraEstatisticas ();
+
+      void setNumCandidatos (int val);
+      int getNumCandidatos ();
+      void setProfundidadeLK (int val);
+      int getProfundidadeLK ();
+      void setNumThreads (int val);
+      int getNumThreads ();
+      void setMaxAvaliacoes (int val);
+      int getMaxAvaliacoes ();
+      void setMaxTempoMutacao (int val);
+      int getMaxTempoMutacao ();
+      void setTemperaturaSA (int val);
+      int getTemperaturaSA ();
+      void setResfriamentoSA (int val);
+      int getResfriamentoSA ();
+      void setIteracoesSA (int val);
+      int getIteracoesSA ();
+
    private:
+      int executa (int tipo, TIndividuo *individuo);
+      //Soma qtde avaliações e retorna true quando o orçamento acabou
+      bool esgotado (long qtde);
+
       //Mutações
       int EM(TIndividuo *individuo);
       int SM(TIndividuo *individuo);
@@ -45,9 +137,30 @@ class TMutacao
       int SIM(TIndividuo *individuo);
       int threeOPT(TIndividuo *individuo);
       int threeOPT2(TIndividuo *individuo);
+      int twoOPTViz(TIndividuo *individuo);
+      int orOPT(TIndividuo *individuo);
+      int LK(TIndividuo *individuo);
+      int threeOPTViz(TIndividuo *individuo);
+      int adaptativa(TIndividuo *individuo);
+      int ILS(TIndividuo *individuo);
+      int SA(TIndividuo *individuo);
 	  
 	  //Métodos auxiliares
 	  double calcValReverso (TGene *g1, TGene *g2);
+      TListaCandidatos *candidatos (TIndividuo *individuo);
+      int acordados (TIndividuo *individuo, vector<char> &olhar);
+      bool precisaOlhar (TIndividuo *individuo, vector<char> &olhar, int indice);
+      void adormece (TIndividuo *individuo, vector<char> &naFila);
+      void mantemAcordados (TIndividuo *individuo, vector<char> &olhar);
+      void ativa (int g, deque<int> &fila, vector<char> &naFila);
+      int tenta2opt (TRota &rota, int a, deque<int> &fila, vector<char> &naFila);
+      int tentaOrOpt (TRota &rota, int a, deque<int> &fila, vector<char> &naFila);
+      int tentaOr3opt (TRota &rota, int t1, deque<int> &fila, vector<char> &naFila);
+      int tentaLK (TRota &rota, int t1, deque<int> &fila, vector<char> &naFila);
+      void paralelo (int qtdeGenes, TMovimento &melhor, function<void(int, int, TMovimento &)> varredura);
+      void varre2opt (TIndividuo *individuo, int t, int numThreads, TMovimento &m);
+      void varre2optVetor (vector<int> &c, vector<double> &e, double dist, int t, int numThreads, TMovimento &m);
+      void varre3opt (TIndividuo *individuo, unsigned semente, int t, int numThreads, TMovimento &m);
 };
 
 #endif
@@ -10,6 +10,8 @@
 
 #include "populacao.hpp"
 #include <iostream>
+#include <cstring>
+#include <cmath>
 
 //Apenas leitura
 TMapaGenes *TPopulacao::getMapa()           { return VP_Mapa; }
@@ -36,9 +38,10 @@ void TPopulacao::add_individuo(TIndividuo *individuo)
    {
       VP_individuos.push_back(individuo);
       VP_somaDistancias += individuo->get_distancia();
+      incluiArestas(individuo);
    }
    else
-	   delete individuo;
+	   VP_reserva.push_back(individuo);
 }
 
 void TPopulacao::add_individuo(vector <TIndividuo *>individuos)
@@ -47,12 +50,49 @@ void TPopulacao::add_individuo(vector <TIndividuo *>individuos)
       add_individuo(individuos[i]);
 }
 
+void TPopulacao::esvazia ()
+{
+   VP_reserva.insert(VP_reserva.end(), VP_individuos.begin(), VP_individuos.end());
+   VP_individuos.clear();
+   VP_heap.clear();
+   VP_somaDistancias = 0;
+   VP_freqArestas.clear();
+   VP_somaFLogF = 0;
+}
+
+TIndividuo *TPopulacao::reserva (TIndividuo *modelo)
+{
+   TIndividuo *individuo;
+
+   if (VP_reserva.empty())
+   {
+      individuo = new TIndividuo(getMapa(), getArqLog());
+      individuo->copia(modelo);
+      return individuo;
+   }
+
+   //Os indivíduos de uma população têm sempre o mesmo conjunto
+   //de genes, por isso basta conferir a quantidade
+   individuo = VP_reserva.back();
+   VP_reserva.pop_back();
+   if (individuo->get_qtdeGenes()!=modelo->get_qtdeGenes()) individuo->copia(modelo);
+   return individuo;
+}
+
+TIndividuo *TPopulacao::clona (TIndividuo *individuo)
+{
+   TIndividuo *clone = reserva(individuo);
+   clone->copia(individuo);
+   return clone;
+}
+
 TPopulacao::TPopulacao (int tamanho, TMapaGenes *mapa, TArqLog *arqSaida)
 {
    VP_Mapa = mapa;
    VP_ArqSaida = arqSaida;
 
    VP_somaDistancias = 0;
+   VP_somaFLogF = 0;
    VP_tamanho = tamanho;
 }
 
@@ -67,6 +107,7 @@ void TPopulacao::povoa()
       individuo->embaralha();
       VP_somaDistancias += individuo->get_distancia();
       VP_individuos.push_back(individuo);
+      incluiArestas(individuo);
    }
 }
 
@@ -86,6 +127,7 @@ void TPopulacao::povoa(vector<TTipoConversao> tabConv, int extraPadrao)
 	  
       VP_somaDistancias += individuo->get_distancia();
       VP_individuos.push_back(individuo);
+      incluiArestas(individuo);
    }
 }
 
@@ -96,6 +138,12 @@ TPopulacao::~TPopulacao()
      delete (*i);
    }
    VP_individuos.clear();
+
+   for (vector< TIndividuo *>::iterator i=VP_reserva.begin(); i!=VP_reserva.end(); ++i)
+   {
+     delete (*i);
+   }
+   VP_reserva.clear();
 }
 
 string TPopulacao::toString ()
@@ -112,25 +160,228 @@ string TPopulacao::toString ()
    return resultado;
 }
 
+void TPopulacao::montaChaves ()
+{
+   unsigned n = VP_individuos.size();
+   VP_chaves.resize(n);
+
+   for (unsigned i=0; i<n; i++)
+   {
+      double dist = VP_individuos[i]->get_distancia();
+      memcpy(&VP_chaves[i].custo, &dist, sizeof(dist));
+      VP_chaves[i].pos = i;
+   }
+}
+
+//Radix sort LSD de 8 bits por passada. Por ser estável, os empates
+//ficam na ordem das posições. As passadas em que todas as chaves têm
+//o mesmo byte são puladas, o que é comum nos bytes mais altos
+void TPopulacao::radix ()
+{
+   unsigned n = VP_chaves.size();
+   VP_chavesAux.resize(n);
+
+   for (int desloc=0; desloc<64; desloc+=8)
+   {
+      unsigned conta[257] = {0};
+      for (unsigned i=0; i<n; i++) conta[((VP_chaves[i].custo>>desloc)&0xFF)+1]++;
+      if (conta[((VP_chaves[0].custo>>desloc)&0xFF)+1]==n) continue;
+
+      for (int d=0; d<256; d++) conta[d+1] += conta[d];
+      for (unsigned i=0; i<n; i++) VP_chavesAux[conta[(VP_chaves[i].custo>>desloc)&0xFF]++] = VP_chaves[i];
+      VP_chaves.swap(VP_chavesAux);
+   }
+}
+
+//Aplica as chaves como permutação dos ponteiros
+void TPopulacao::aplicaChaves ()
+{
+   unsigned n = VP_chaves.size();
+   VP_ordenados.resize(n);
+   for (unsigned i=0; i<n; i++) VP_ordenados[i] = VP_individuos[VP_chaves[i].pos];
+   VP_individuos.swap(VP_ordenados);
+   VP_heap.clear();
+}
+
+//A ordenação é feita sobre um vetor compacto de chaves, sem acessar os
+//indivíduos espalhados na memória a cada comparação
 void TPopulacao::ordena()
 {
-   //sort (VP_individuos.begin(), VP_individuos.end(), comparaMelhor);
-   qsort (&VP_individuos[0], VP_individuos.size(), sizeof (TIndividuo *), comparaMelhor);
+   if (VP_individuos.empty()) return;
+
+   montaChaves();
+   if (VP_chaves.size()>=minRadix) radix();
+   else sort(VP_chaves.begin(), VP_chaves.end());
+   aplicaChaves();
 }
 
-int TPopulacao::comparaMelhor(const void *Indi, const void *Indj)
+void TPopulacao::ordena(unsigned qtde)
 {
-   //As linhas comentadas referen-se a comparação com o sort
-   //TIndividuo *i =  (TIndividuo *) Indi;
-   //TIndividuo *j =  (TIndividuo *) Indj;
+   unsigned n = VP_individuos.size();
+   if (n==0) return;
 
-   TIndividuo *i =  *(TIndividuo **) Indi;
-   TIndividuo *j =  *(TIndividuo **) Indj;
+   montaChaves();
 
-   //return i->get_distancia() < j->get_distancia();
-   if(i->get_distancia() > j->get_distancia()) return 1;
-   if(i->get_distancia() < j->get_distancia()) return -1;
-   return 0;
+   //Os empates de distância não contam para qtde, então o prefixo
+   //ordenado cresce até ter qtde distâncias distintas
+   unsigned k = max(qtde, 1u);
+   while (true)
+   {
+      if (k>=n)
+      {
+         if (n>=minRadix) radix();
+         else sort(VP_chaves.begin(), VP_chaves.end());
+         break;
+      }
+
+      partial_sort(VP_chaves.begin(), VP_chaves.begin()+k, VP_chaves.end());
+
+      unsigned distintas = 1;
+      for (unsigned i=1; i<k; i++)
+         if (VP_chaves[i].custo!=VP_chaves[i-1].custo) distintas++;
+      if (distintas>=qtde)
+      {
+         swap(VP_chaves[n-1], *max_element(VP_chaves.begin()+k, VP_chaves.end()));
+         break;
+      }
+
+      k *= 2;
+   }
+
+   aplicaChaves();
+}
+
+double TPopulacao::distHeap (unsigned h) { return VP_individuos[VP_heap[h]]->get_distancia(); }
+
+void TPopulacao::trocaHeap (unsigned h1, unsigned h2)
+{
+   swap(VP_heap[h1], VP_heap[h2]);
+   VP_posHeap[VP_heap[h1]] = h1;
+   VP_posHeap[VP_heap[h2]] = h2;
+}
+
+void TPopulacao::sobeHeap (unsigned h)
+{
+   while ((h>0)&&(distHeap((h-1)/2)<distHeap(h)))
+   {
+      trocaHeap(h, (h-1)/2);
+      h = (h-1)/2;
+   }
+}
+
+void TPopulacao::desceHeap (unsigned h)
+{
+   unsigned n = VP_heap.size();
+   while (true)
+   {
+      unsigned maior = h;
+      unsigned f = 2*h+1;
+      if ((f<n)&&(distHeap(f)>distHeap(maior))) maior = f;
+      if ((f+1<n)&&(distHeap(f+1)>distHeap(maior))) maior = f+1;
+      if (maior==h) return;
+
+      trocaHeap(h, maior);
+      h = maior;
+   }
+}
+
+void TPopulacao::montaHeap ()
+{
+   unsigned n = VP_individuos.size();
+   VP_heap.resize(n);
+   VP_posHeap.resize(n);
+   VP_qtdeDist.clear();
+
+   for (unsigned i=0; i<n; i++)
+   {
+      VP_heap[i] = i;
+      VP_posHeap[i] = i;
+      VP_qtdeDist[VP_individuos[i]->get_distancia()]++;
+   }
+
+   for (int h=n/2-1; h>=0; h--) desceHeap(h);
+}
+
+TIndividuo *TPopulacao::get_piorHeap () { return VP_individuos[VP_heap[0]]; }
+
+bool TPopulacao::temDistancia (double dist) { return VP_qtdeDist.count(dist)>0; }
+
+unsigned TPopulacao::substituiPior (TIndividuo *individuo)
+{
+   unsigned pos = VP_heap[0];
+   TIndividuo *pior = VP_individuos[pos];
+
+   if (--VP_qtdeDist[pior->get_distancia()]==0) VP_qtdeDist.erase(pior->get_distancia());
+   VP_qtdeDist[individuo->get_distancia()]++;
+   VP_somaDistancias += individuo->get_distancia() - pior->get_distancia();
+   retiraArestas(pior);
+   incluiArestas(individuo);
+
+   VP_reserva.push_back(pior);
+   VP_individuos[pos] = individuo;
+   desceHeap(0);
+
+   return pos;
+}
+
+void TPopulacao::atualizaHeap (unsigned pos, double anterior)
+{
+   double dist = VP_individuos[pos]->get_distancia();
+   if (dist==anterior) return;
+
+   if (--VP_qtdeDist[anterior]==0) VP_qtdeDist.erase(anterior);
+   VP_qtdeDist[dist]++;
+
+   if (dist>anterior) sobeHeap(VP_posHeap[pos]);
+   else desceHeap(VP_posHeap[pos]);
+}
+
+void TPopulacao::descarta (TIndividuo *individuo) { VP_reserva.push_back(individuo); }
+
+void TPopulacao::contaArestas (TIndividuo *individuo, int sinal)
+{
+   bool simetrico = individuo->simetrico();
+   TGene *gene = individuo->get_ini();
+
+   for (int k=0; k<individuo->get_qtdeGenes(); k++, gene=gene->prox)
+   {
+      unsigned a = gene->id;
+      unsigned b = gene->prox->id;
+      if ((simetrico)&&(b<a)) swap(a, b);
+
+      unsigned long long chave = ((unsigned long long)a<<32)|b;
+      int &f = VP_freqArestas[chave];
+      if (f>1) VP_somaFLogF -= f*log(f);
+      f += sinal;
+      if (f>1) VP_somaFLogF += f*log(f);
+      if (f==0) VP_freqArestas.erase(chave);
+   }
+}
+
+void TPopulacao::retiraArestas (TIndividuo *individuo) { contaArestas(individuo, -1); }
+void TPopulacao::incluiArestas (TIndividuo *individuo) { contaArestas(individuo, 1); }
+
+int TPopulacao::get_freqAresta (int idA, int idB)
+{
+   if ((!VP_individuos.empty())&&(VP_individuos[0]->simetrico())&&(idB<idA)) swap(idA, idB);
+
+   unordered_map <unsigned long long, int>::iterator i = VP_freqArestas.find(((unsigned long long)idA<<32)|(unsigned)idB);
+   return (i==VP_freqArestas.end()) ? 0 : i->second;
+}
+
+int TPopulacao::get_qtdeArestas () { return VP_freqArestas.size(); }
+
+//H = -soma(f/P * log(f/P)) = (F*log(P) - soma(f*log(f)))/P, com P
+//indivíduos e F arestas no total
+double TPopulacao::entropiaArestas ()
+{
+   double P = VP_individuos.size();
+   if (P==0) return 0;
+
+   double F = 0;
+   for (TIndividuo *individuo : VP_individuos) F += individuo->get_qtdeGenes();
+
+   return (F*log(P) - VP_somaFLogF)/P;
 }
 
 void TPopulacao::troca (int indice1, int indice2)
@@ -139,6 +390,13 @@ void TPopulacao::troca (int indice1, int indice2)
    temp = VP_individuos[indice1];
    VP_individuos[indice1] = VP_individuos[indice2];
    VP_individuos[indice2] = temp;
+
+   //Com o heap ativo, as suas entradas acompanham os indivíduos
+   if (!VP_heap.empty())
+   {
+      swap(VP_heap[VP_posHeap[indice1]], VP_heap[VP_posHeap[indice2]]);
+      swap(VP_posHeap[indice1], VP_posHeap[indice2]);
+   }
 }
 
 TIndividuo *TPopulacao::get_melhor() { return VP_individuos[0]; }
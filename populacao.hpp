@@ -16,13 +16,28 @@
 #include "individuo.hpp"
 #include <vector>
 #include <algorithm>
+#include <unordered_map>
 
-class TPopulacao
+//Abaixo desta quantidade de indivíduos o radix sort não compensa
+//as suas passadas sobre as chaves
+const unsigned minRadix = 256;
+
+//Chave de ordenação: bits da distância (não negativa, por isso na
+//mesma ordem do double) e posição do indivíduo no vetor
+struct TChavePop
 {
-   static int comparaMelhor(const void *Indi, const void *Indj);
+   unsigned long long custo;
+   unsigned pos;
+
+   bool operator< (const TChavePop &c) const { return (custo<c.custo)||((custo==c.custo)&&(pos<c.pos)); }
+};
 
+class TPopulacao
+{
    private:
       vector <TIndividuo *> VP_individuos;
+      //Indivíduos fora da população, reaproveitados pelos próximos filhos
+      vector <TIndividuo *> VP_reserva;
 
       double VP_somaDistancias;
       unsigned VP_tamanho;
@@ -30,6 +45,35 @@ class TPopulacao
       TMapaGenes *VP_Mapa;
       TArqLog *VP_ArqSaida;
 
+      //Áreas de trabalho da ordenação, reaproveitadas a cada geração
+      vector <TChavePop> VP_chaves;
+      vector <TChavePop> VP_chavesAux;
+      vector <TIndividuo *> VP_ordenados;
+
+      void montaChaves ();
+      void radix ();
+      void aplicaChaves ();
+
+      //Modo steady-state: heap de máximo das posições dos indivíduos,
+      //pela distância, com a posição de cada indivíduo no heap e a
+      //quantidade de indivíduos com cada distância
+      vector <unsigned> VP_heap;
+      vector <unsigned> VP_posHeap;
+      unordered_map <double, int> VP_qtdeDist;
+
+      double distHeap (unsigned h);
+      void trocaHeap (unsigned h1, unsigned h2);
+      void sobeHeap (unsigned h);
+      void desceHeap (unsigned h);
+
+      //Frequência de cada aresta (par de ids, sem direção quando o
+      //indivíduo é simétrico) entre os indivíduos da população.
+      //A soma de f*log(f) acompanha a tabela para a entropia
+      unordered_map <unsigned long long, int> VP_freqArestas;
+      double VP_somaFLogF;
+
+      void contaArestas (TIndividuo *individuo, int sinal);
+
    public:
       //Apenas leitura
       TMapaGenes *getMapa();
@@ -56,8 +100,40 @@ class TPopulacao
 	  void troca (int indice1, int indice2);
       void add_individuo (TIndividuo *individuo);
 	  void add_individuo(vector <TIndividuo *>individuos);
+
+      //Passa todos os indivíduos para a reserva
+      void esvazia ();
+      //Indivíduo da reserva com os mesmos genes do modelo, em qualquer
+      //ordem. Só aloca um novo quando a reserva está vazia
+      TIndividuo *reserva (TIndividuo *modelo);
+      //Cópia do indivíduo feita sobre um indivíduo da reserva
+      TIndividuo *clona (TIndividuo *individuo);
       string toString ();
       void ordena();
+      //Ordena só até a qtde-ésima distância distinta. O restante fica
+      //depois, fora de ordem, com o pior na última posição
+      void ordena(unsigned qtde);
+
+      //Heap do modo steady-state. Vale até a próxima ordenação
+      void montaHeap ();
+      TIndividuo *get_piorHeap ();
+      bool temDistancia (double dist);
+      //Põe o indivíduo no lugar do pior, que vai para a reserva, e
+      //retorna a posição ocupada
+      unsigned substituiPior (TIndividuo *individuo);
+      //Reposiciona o indivíduo da posição, cuja distância era anterior
+      void atualizaHeap (unsigned pos, double anterior);
+      //Devolve à reserva um indivíduo que não entrou na população
+      void descarta (TIndividuo *individuo);
+
+      //Frequência das arestas. Quem altera um indivíduo da população
+      //retira as suas arestas antes e inclui depois
+      void retiraArestas (TIndividuo *individuo);
+      void incluiArestas (TIndividuo *individuo);
+      int get_freqAresta (int idA, int idB);
+      int get_qtdeArestas ();
+      //Entropia das arestas (Nagata & Kobayashi, 2013)
+      double entropiaArestas ();
 };
 
 #endif
@@ -0,0 +1,77 @@
+/*
+*  roleta.cpp
+*
+*  Módulo responsável pela roleta de seleção dos pais, sorteio
+*  proporcional a pesos pelo método alias de Walker
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#include "roleta.hpp"
+
+int TRoleta::get_tamanho () { return VP_prob.size(); }
+
+/**
+ *
+ * Método alias
+ *
+ * Walker (1977). An Efficient Method for Generating Discrete Random
+ * Variables with General Distributions. ACM Transactions on Mathematical
+ * Software, 3(3), 253–256.
+ *
+ * Vose (1991). A Linear Algorithm for Generating Random Numbers with a
+ * Given Distribution. IEEE Transactions on Software Engineering, 17(9),
+ * 972–975.
+ *
+ * Os pesos são escalados para média 1. Cada posição abaixo de 1 é
+ * completada por uma acima de 1, que perde a diferença e volta para a
+ * pilha correspondente.
+ *
+ **/
+void TRoleta::monta (vector<double> &pesos)
+{
+   int n = pesos.size();
+   double soma = 0;
+   for (int i=0; i<n; i++) soma += pesos[i];
+
+   VP_prob.resize(n);
+   VP_alias.resize(n);
+
+   vector<int> menores;
+   vector<int> maiores;
+   for (int i=0; i<n; i++)
+   {
+      VP_prob[i] = pesos[i]*n/soma;
+      VP_alias[i] = i;
+      if (VP_prob[i]<1) menores.push_back(i);
+      else maiores.push_back(i);
+   }
+
+   while ((!menores.empty())&&(!maiores.empty()))
+   {
+      int m = menores.back(); menores.pop_back();
+      int g = maiores.back();
+
+      VP_alias[m] = g;
+      VP_prob[g] -= 1-VP_prob[m];
+      if (VP_prob[g]<1)
+      {
+         maiores.pop_back();
+         menores.push_back(g);
+      }
+   }
+
+   //Sobras do arredondamento
+   for (int i : menores) VP_prob[i] = 1;
+   for (int i : maiores) VP_prob[i] = 1;
+}
+
+int TRoleta::sorteia ()
+{
+   int i = TUtils::rnd(0, VP_prob.size()-1);
+   return (TUtils::rndDouble()<VP_prob[i]) ? i : VP_alias[i];
+}
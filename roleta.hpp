@@ -0,0 +1,38 @@
+/*
+*  roleta.hpp
+*
+*  Módulo responsável pela roleta de seleção dos pais, sorteio
+*  proporcional a pesos pelo método alias de Walker
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#ifndef _ROLETA_H
+#define	_ROLETA_H
+
+#include <vector>
+#include "utils.hpp"
+
+/*************************************************************
+Cada posição i guarda a probabilidade de ficar com i e o alias
+que fica com o restante. O sorteio escolhe uma posição e uma
+moeda, custando O(1) depois da montagem em O(n).
+*************************************************************/
+class TRoleta
+{
+   private:
+      vector<double> VP_prob;
+      vector<int> VP_alias;
+
+   public:
+      //Pesos não negativos, com pelo menos um positivo
+      void monta (vector<double> &pesos);
+      int sorteia ();
+      int get_tamanho ();
+};
+
+#endif
@@ -0,0 +1,150 @@
+/*
+*  rota.cpp
+*
+*  Módulo responsável pela representação da rota em vetor, utilizada
+*  pelas buscas locais. Permite consultar sucessor, antecessor e
+*  inverter sub-rotas sem o custo do encadeamento do indivíduo
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#include "rota.hpp"
+
+TRota::TRota (TMapaGenes *mapa)
+{
+   VP_Mapa = mapa;
+   VP_n = 0;
+   VP_registra = false;
+}
+
+void TRota::carrega (TIndividuo *individuo)
+{
+   VP_n = individuo->get_qtdeGenes();
+   VP_rota.resize(VP_n);
+   VP_pos.resize(VP_n);
+   VP_ori.resize(VP_n);
+   VP_dest.resize(VP_n);
+
+   for (int p=0; p<VP_n; p++)
+   {
+      TGene *g = individuo->get_por_indice(p);
+      VP_rota[p] = g->id;
+      VP_pos[g->id] = p;
+      VP_ori[g->id] = g->ori;
+      VP_dest[g->id] = g->dest;
+   }
+}
+
+void TRota::descarrega (TIndividuo *individuo)
+{
+   vector<int> ids (VP_n);
+   int p = VP_pos[0];
+
+   for (int k=0; k<VP_n; k++)
+   {
+      ids[k] = VP_rota[p];
+      p = (p+1==VP_n)?0:p+1;
+   }
+
+   individuo->reordena(ids);
+}
+
+double TRota::custo ()
+{
+   double tot = 0;
+   for (int p=0; p<VP_n; p++)
+      tot += dist(VP_rota[p], VP_rota[(p+1==VP_n)?0:p+1]);
+   return tot;
+}
+
+bool TRota::entre (int a, int b, int c)
+{
+   int i = VP_pos[a];
+   int j = VP_pos[b];
+   int k = VP_pos[c];
+
+   if (i<=k) return (i<=j)&&(j<=k);
+   return (j>=i)||(j<=k);
+}
+
+void TRota::inverte (int de, int ate)
+{
+   int i = VP_pos[de];
+   int j = VP_pos[ate];
+
+   //Quantidade de genes no caminho de "de" até "ate"
+   int tam = j-i+1;
+   if (tam<=0) tam += VP_n;
+
+   //Inverter o complemento gera a mesma rota no sentido contrário
+   if (2*tam>VP_n)
+   {
+      int novoI = (j+1==VP_n)?0:j+1;
+      int novoJ = (i==0)?VP_n-1:i-1;
+      i = novoI;
+      j = novoJ;
+      tam = VP_n-tam;
+   }
+
+   if (VP_registra)
+   {
+      VP_registro.push_back(i);
+      VP_registro.push_back(tam);
+   }
+   invertePos(i, tam);
+}
+
+//Inverte as posições i..i+tam-1, circularmente
+void TRota::invertePos (int i, int tam)
+{
+   int j = (i+tam-1)%VP_n;
+   for (int k=0; k<tam/2; k++)
+   {
+      int gi = VP_rota[i];
+      int gj = VP_rota[j];
+      VP_rota[i] = gj;
+      VP_pos[gj] = i;
+      VP_rota[j] = gi;
+      VP_pos[gi] = j;
+
+      i = (i+1==VP_n)?0:i+1;
+      j = (j==0)?VP_n-1:j-1;
+   }
+}
+
+void TRota::move2opt (int t1, int t2, int t3, int t4)
+{
+   if (prox(t1)==t2) inverte(t2, t3);
+   else inverte(t1, t4);
+}
+
+void TRota::moveSegmento (int s1, int sL, int x, int y, bool invertido)
+{
+   int p = ant(s1);
+   int q = prox(sL);
+
+   //p s1..sL q..x y  =>  p x..q sL..s1 y
+   move2opt(p, s1, x, y);
+   //p x..q sL..s1 y  =>  p q..x sL..s1 y
+   move2opt(p, x, q, sL);
+   //x sL..s1 y  =>  x s1..sL y
+   if (!invertido) move2opt(x, sL, s1, y);
+}
+
+void TRota::marca ()
+{
+   VP_registra = true;
+   VP_registro.clear();
+}
+
+void TRota::volta ()
+{
+   //Inverter as mesmas posições de novo desfaz a inversão
+   for (int k=VP_registro.size()-2; k>=0; k-=2)
+      invertePos(VP_registro[k], VP_registro[k+1]);
+   VP_registro.clear();
+}
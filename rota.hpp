@@ -0,0 +1,83 @@
+/*
+*  rota.hpp
+*
+*  Módulo responsável pela representação da rota em vetor, utilizada
+*  pelas buscas locais. Permite consultar sucessor, antecessor e
+*  inverter sub-rotas sem o custo do encadeamento do indivíduo
+*  Autor: Geraldo José Ferreira Chagas Junior - gjr.doc@gmail.com
+*
+*  PPGI - NCE - UFRJ
+*  Data Criação: 19/10/2026
+*  Datas de Modificações:
+*
+*/
+
+#ifndef _ROTA_H
+#define	_ROTA_H
+
+#include <vector>
+#include "individuo.hpp"
+#include "tsp.hpp"
+
+/*************************************************************
+Rota como vetor de ids e vetor de posições. A inversão é feita
+sempre no lado mais curto do ciclo, portanto o gene 0 pode sair
+da posição 0. Ao descarregar no indivíduo, o 0 volta ao início.
+Só deve ser utilizada quando o indivíduo é simétrico.
+*************************************************************/
+class TRota
+{
+   private:
+      TMapaGenes *VP_Mapa;
+
+      int VP_n;
+      vector<int> VP_rota;
+      vector<int> VP_pos;
+      vector<int> VP_ori;
+      vector<int> VP_dest;
+
+      //Inversões feitas desde marca(), como pares (posição inicial, tamanho)
+      bool VP_registra;
+      vector<int> VP_registro;
+
+      void invertePos (int i, int tam);
+
+   public:
+      TRota (TMapaGenes *mapa);
+
+      //Copia a sequência do indivíduo para o vetor
+      void carrega (TIndividuo *individuo);
+      //Copia a sequência do vetor para o indivíduo
+      void descarrega (TIndividuo *individuo);
+
+      int get_qtde () { return VP_n; }
+      int get_pos (int g) { return VP_pos[g]; }
+      int get_por_pos (int p) { return VP_rota[p]; }
+      int prox (int g) { return VP_rota[(VP_pos[g]+1==VP_n)?0:VP_pos[g]+1]; }
+      int ant (int g)  { return VP_rota[(VP_pos[g]==0)?VP_n-1:VP_pos[g]-1]; }
+
+      double dist (int a, int b) { return VP_Mapa->get_distancia(VP_ori[a], VP_dest[b]); }
+      double custo ();
+
+      //Se b está no caminho de a até c, seguindo o sentido da rota
+      bool entre (int a, int b, int c);
+
+      //Inverte o caminho de "de" até "ate", seguindo o sentido da rota
+      void inverte (int de, int ate);
+
+      //Troca as arestas (t1,t2) e (t3,t4) por (t1,t3) e (t2,t4).
+      //t2 deve ser o sucessor de t1 e t4 de t3, ou ambos antecessores
+      void move2opt (int t1, int t2, int t3, int t4);
+
+      //Move o segmento s1..sL (s1 antes de sL) para entre x e y = prox(x).
+      //Se invertido, a rota fica x sL..s1 y, senão x s1..sL y
+      void moveSegmento (int s1, int sL, int x, int y, bool invertido);
+
+      //Passa a registrar as inversões, descartando o registro anterior
+      void marca ();
+      //Desfaz as inversões registradas desde marca(), voltando ao mesmo
+      //vetor em tempo proporcional aos genes movidos
+      void volta ();
+};
+
+#endif
@@ -85,6 +85,7 @@ void TMapaGenes::preencheMapa(xmlDocPtr doc, xmlNode * a_node)
 TMapaGenes::TMapaGenes ()
 {
       VP_qtdeGenes = -1;
+      VP_simetrico = -1;
 }
 
 TMapaGenes::TMapaGenes (int numGenes)
@@ -94,6 +95,8 @@ TMapaGenes::TMapaGenes (int numGenes)
 
 int TMapaGenes::get_qtdeGenes () { return VP_qtdeGenes; };
 
+double *TMapaGenes::get_matriz () { return VP_mapaDist[0]; };
+
 void TMapaGenes::carregaDoArquivo(char *nomeArquivo)
 {
        xmlDoc *doc = NULL;
@@ -132,11 +135,16 @@ void TMapaGenes::inicializa (int numGenes)
        int i;
        int j;
        VP_qtdeGenes = numGenes;
+       VP_simetrico = -1;
        VP_mapaDist = (double **) malloc(numGenes*sizeof(double *));
 
+       //As linhas ficam em um único bloco contíguo, permitindo
+       //o acesso vetorizado (get_matriz)
+       if (numGenes>0) VP_mapaDist[0] = (double *) malloc((size_t)numGenes*numGenes*sizeof(double));
+
        for (i=0; i<VP_qtdeGenes; i++)
        {
-          VP_mapaDist [i] = (double *) malloc(numGenes*sizeof(double));
+          VP_mapaDist [i] = VP_mapaDist[0] + (size_t)i*numGenes;
           for (j=0; j<VP_qtdeGenes; j++)
           {
              VP_mapaDist[i][j] = infinito; //Inicia Todos os genes com valor infinito na distância
@@ -149,15 +157,12 @@ void TMapaGenes::inicializa (int numGenes)
 
 TMapaGenes::~TMapaGenes ()
 {
-       int i;
-
-       for (i=VP_qtdeGenes-1; i>=0; i--)
+       if (VP_qtdeGenes>0)
        {
-          free (VP_mapaDist [i]);
+          free (VP_mapaDist [0]);
+          free (VP_mapaDist);
        }
 
-       if (VP_qtdeGenes>0) free (VP_mapaDist);
-
  }
 
 void TMapaGenes::set_distancia(int geneOri, int geneDest, double distancia)
@@ -165,7 +170,10 @@ void TMapaGenes::set_distancia(int geneOri, int geneDest, double distancia)
        //a distância do gene para ele mesmo não pode ser alterada
        //nenum gene pode está fora do indice d tabela
        if ((geneOri!=geneDest)&&(geneOri>=0)&&(geneOri<VP_qtdeGenes)&&(geneDest>=0)&&(geneDest<VP_qtdeGenes))
+       {
           VP_mapaDist[geneOri][geneDest] = distancia;
+          VP_simetrico = -1;
+       }
 }
 
 double TMapaGenes::get_distancia(int geneOri, int geneDest)
@@ -176,3 +184,20 @@ double TMapaGenes::get_distancia(int geneOri, int geneDest)
        else
           return 0.0;
 }
+
+bool TMapaGenes::simetrico()
+{
+       //A verificação é feita uma única vez, O(n^2)
+       if (VP_simetrico<0)
+       {
+          VP_simetrico = 1;
+          for (int i=0; (i<VP_qtdeGenes)&&VP_simetrico; i++)
+             for (int j=i+1; j<VP_qtdeGenes; j++)
+                if (VP_mapaDist[i][j]!=VP_mapaDist[j][i])
+                {
+                   VP_simetrico = 0;
+                   break;
+                }
+       }
+       return VP_simetrico==1;
+}
@@ -26,6 +26,7 @@ class TMapaGenes
    private:
       double **VP_mapaDist;
       int VP_qtdeGenes;
+      int VP_simetrico;   //-1 enquanto não verificado
 
    //Metodos Privados
    int getNumGeneDoArquivo(xmlDocPtr doc, xmlNode * a_node);
@@ -40,6 +41,9 @@ class TMapaGenes
 
       int get_qtdeGenes ();
 
+      //Matriz de distâncias contígua, linha a linha (origem * n + destino)
+      double *get_matriz ();
+
       void carregaDoArquivo(char *nomeArquivo);
 
       void inicializa (int numGenes);
@@ -50,6 +54,9 @@ class TMapaGenes
 
       double get_distancia(int geneOri, int geneDest);
 
+      //Se a distância de ida é igual à de volta para todos os genes
+      bool simetrico();
+
 };
 
 #endif
@@ -28,3 +28,8 @@ int TUtils::rnd(unsigned low, unsigned high)
    return rand() % (high-low+1) + low;
 }
 
+double TUtils::rndDouble()
+{
+   return rand() / ((double)RAND_MAX + 1);
+}
+
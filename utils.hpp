@@ -20,6 +20,8 @@ class TUtils
 
       static void initRnd ();
       static int rnd(unsigned low, unsigned high);
+      //Real em [0, 1)
+      static double rndDouble();
 };
 
 #endif	/* _UTIL_H */